@@ -22,6 +22,7 @@ QUANTUM_SRC += \
     $(QUANTUM_DIR)/action_tapping.c \
     $(QUANTUM_DIR)/action_util.c \
     $(QUANTUM_DIR)/eeconfig.c \
+    $(QUANTUM_DIR)/feature_timer.c \
     $(QUANTUM_DIR)/keyboard.c \
     $(QUANTUM_DIR)/keymap_common.c \
     $(QUANTUM_DIR)/keycode_config.c \
@@ -44,6 +45,10 @@ else ifeq ($(strip $(DEBUG_MATRIX_SCAN_RATE_ENABLE)), api)
     OPT_DEFS += -DDEBUG_MATRIX_SCAN_RATE
 endif
 
+ifneq ($(filter yes, $(strip $(SCAN_PROFILER_ENABLE)) $(strip $(LATENCY_TRACER_ENABLE))),)
+    SRC += $(QUANTUM_DIR)/timing_histogram.c
+endif
+
 AUDIO_ENABLE ?= no
 ifeq ($(strip $(AUDIO_ENABLE)), yes)
     ifeq ($(PLATFORM),CHIBIOS)
@@ -35,6 +35,7 @@ GENERIC_FEATURES = \
     HAPTIC \
     KEY_LOCK \
     KEY_OVERRIDE \
+    LATENCY_TRACER \
     LEADER \
     MAGIC \
     MOUSEKEY \
@@ -42,6 +43,7 @@ GENERIC_FEATURES = \
     OS_DETECTION \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
+    SCAN_PROFILER \
     SECURE \
     SEND_STRING \
     SEQUENCER \
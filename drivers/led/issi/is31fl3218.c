@@ -32,6 +32,8 @@
 uint8_t g_twi_transfer_buffer[20];
 
 // IS31FL3218 has 18 PWM outputs and a fixed I2C address, so no chaining.
+// The 18 PWM registers go out in a single transfer, so unlike the larger
+// drivers there are no blocks to track and one flag covers the whole buffer.
 uint8_t g_pwm_buffer[IS31FL3218_PWM_REGISTER_COUNT];
 bool    g_pwm_buffer_update_required = false;
 
@@ -41,7 +41,8 @@ uint8_t g_twi_transfer_buffer[20];
 // buffers and the transfers in is31fl3731_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 uint8_t g_pwm_buffer[IS31FL3731_DRIVER_COUNT][IS31FL3731_PWM_REGISTER_COUNT];
-bool    g_pwm_buffer_update_required[IS31FL3731_DRIVER_COUNT] = {false};
+// One bit per 16 byte block of g_pwm_buffer, set when the block changed since the last flush
+uint16_t g_pwm_buffer_dirty_blocks[IS31FL3731_DRIVER_COUNT] = {0};
 
 uint8_t g_led_control_registers[IS31FL3731_DRIVER_COUNT][IS31FL3731_LED_CONTROL_REGISTER_COUNT] = {0};
 bool    g_led_control_registers_update_required[IS31FL3731_DRIVER_COUNT]                        = {false};
@@ -59,14 +60,18 @@ void is31fl3731_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
 #endif
 }
 
-void is31fl3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+static void is31fl3731_write_pwm_blocks(uint8_t addr, uint8_t *pwm_buffer, uint16_t blocks) {
     // assumes bank is already selected
 
-    // transmit PWM registers in 9 transfers of 16 bytes
+    // transmit the PWM registers of each block in a transfer of 16 bytes
     // g_twi_transfer_buffer[] is 20 bytes
 
-    // iterate over the pwm_buffer contents at 16 byte intervals
+    // iterate over the pwm_buffer contents at 16 byte intervals, skipping clean blocks
     for (int i = 0; i < IS31FL3731_PWM_REGISTER_COUNT; i += 16) {
+        if (!(blocks & (1 << (i / 16)))) {
+            continue;
+        }
+
         // set the first register, e.g. 0x24, 0x34, 0x44, etc.
         g_twi_transfer_buffer[0] = 0x24 + i;
         // copy the data from i to i+15
@@ -84,6 +89,35 @@ void is31fl3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
     }
 }
 
+void is31fl3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+    is31fl3731_write_pwm_blocks(addr, pwm_buffer, UINT16_MAX);
+}
+
+#ifdef I2C_ASYNC_ENABLE
+static void is31fl3731_queue_transfer(uint8_t addr, uint8_t *data, uint8_t length) {
+    // The data is copied into the queue, so the buffer can be reused straight away.
+    // The I2C thread retries it up to IS31FL3731_I2C_PERSISTENCE times, like the blocking writes.
+    i2c_transmit_async(addr << 1, data, length, IS31FL3731_I2C_TIMEOUT, IS31FL3731_I2C_PERSISTENCE, NULL, NULL);
+}
+
+static void is31fl3731_queue_pwm_blocks(uint8_t addr, uint8_t *pwm_buffer, uint16_t blocks) {
+    // Queue the PWM registers of each dirty block in a transfer of 16 bytes, the bank is already selected
+    for (int i = 0; i < IS31FL3731_PWM_REGISTER_COUNT; i += 16) {
+        if (!(blocks & (1 << (i / 16)))) {
+            continue;
+        }
+
+        g_twi_transfer_buffer[0] = 0x24 + i;
+        memcpy(g_twi_transfer_buffer + 1, pwm_buffer + i, 16);
+        is31fl3731_queue_transfer(addr, g_twi_transfer_buffer, 17);
+    }
+}
+
+bool is31fl3731_flush_busy(void) {
+    return i2c_async_busy();
+}
+#endif
+
 void is31fl3731_init_drivers(void) {
     i2c_init();
 
@@ -178,10 +212,10 @@ void is31fl3731_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         if (g_pwm_buffer[led.driver][led.r - 0x24] == red && g_pwm_buffer[led.driver][led.g - 0x24] == green && g_pwm_buffer[led.driver][led.b - 0x24] == blue) {
             return;
         }
-        g_pwm_buffer[led.driver][led.r - 0x24]   = red;
-        g_pwm_buffer[led.driver][led.g - 0x24]   = green;
-        g_pwm_buffer[led.driver][led.b - 0x24]   = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer[led.driver][led.r - 0x24] = red;
+        g_pwm_buffer[led.driver][led.g - 0x24] = green;
+        g_pwm_buffer[led.driver][led.b - 0x24] = blue;
+        g_pwm_buffer_dirty_blocks[led.driver] |= (1 << ((led.r - 0x24) / 16)) | (1 << ((led.g - 0x24) / 16)) | (1 << ((led.b - 0x24) / 16));
     }
 }
 
@@ -222,10 +256,14 @@ void is31fl3731_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void is31fl3731_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
-        is31fl3731_write_pwm_buffer(addr, g_pwm_buffer[index]);
+    if (g_pwm_buffer_dirty_blocks[index]) {
+#ifdef I2C_ASYNC_ENABLE
+        is31fl3731_queue_pwm_blocks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty_blocks[index]);
+#else
+        is31fl3731_write_pwm_blocks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty_blocks[index]);
+#endif
     }
-    g_pwm_buffer_update_required[index] = false;
+    g_pwm_buffer_dirty_blocks[index] = 0;
 }
 
 void is31fl3731_update_led_control_registers(uint8_t addr, uint8_t index) {
@@ -120,6 +120,11 @@ void is31fl3731_update_led_control_registers(uint8_t addr, uint8_t index);
 
 void is31fl3731_flush(void);
 
+#ifdef I2C_ASYNC_ENABLE
+// Whether the PWM transfers queued by the last flush are still being sent
+bool is31fl3731_flush_busy(void);
+#endif
+
 #define C1_1 0x24
 #define C1_2 0x25
 #define C1_3 0x26
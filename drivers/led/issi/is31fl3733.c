@@ -72,7 +72,8 @@ uint8_t g_twi_transfer_buffer[20];
 // buffers and the transfers in is31fl3733_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 uint8_t g_pwm_buffer[IS31FL3733_DRIVER_COUNT][IS31FL3733_PWM_REGISTER_COUNT];
-bool    g_pwm_buffer_update_required[IS31FL3733_DRIVER_COUNT] = {false};
+// One bit per 16 byte block of g_pwm_buffer, set when the block changed since the last flush
+uint16_t g_pwm_buffer_dirty_blocks[IS31FL3733_DRIVER_COUNT] = {0};
 
 uint8_t g_led_control_registers[IS31FL3733_DRIVER_COUNT][IS31FL3733_LED_CONTROL_REGISTER_COUNT] = {0};
 bool    g_led_control_registers_update_required[IS31FL3733_DRIVER_COUNT]                        = {false};
@@ -96,14 +97,18 @@ bool is31fl3733_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
     return true;
 }
 
-bool is31fl3733_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+static bool is31fl3733_write_pwm_blocks(uint8_t addr, uint8_t *pwm_buffer, uint16_t blocks) {
     // Assumes PG1 is already selected.
     // If any of the transactions fails function returns false.
-    // Transmit PWM registers in 12 transfers of 16 bytes.
+    // Transmit the PWM registers of each block in a transfer of 16 bytes.
     // g_twi_transfer_buffer[] is 20 bytes
 
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
+    // Iterate over the pwm_buffer contents at 16 byte intervals, skipping clean blocks.
     for (int i = 0; i < IS31FL3733_PWM_REGISTER_COUNT; i += 16) {
+        if (!(blocks & (1 << (i / 16)))) {
+            continue;
+        }
+
         g_twi_transfer_buffer[0] = i;
         // Copy the data from i to i+15.
         // Device will auto-increment register for data after the first byte
@@ -125,6 +130,52 @@ bool is31fl3733_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
     return true;
 }
 
+bool is31fl3733_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+    return is31fl3733_write_pwm_blocks(addr, pwm_buffer, UINT16_MAX);
+}
+
+#ifdef I2C_ASYNC_ENABLE
+static void is31fl3733_queue_callback(i2c_status_t status, void *context) {
+    // If any of the transactions fail we risk writing dirty PG0,
+    // refresh page 0 just in case.
+    if (status != I2C_STATUS_SUCCESS) {
+        g_led_control_registers_update_required[(uintptr_t)context] = true;
+    }
+}
+
+static void is31fl3733_queue_transfer(uint8_t addr, uint8_t index, uint8_t *data, uint8_t length) {
+    // The data is copied into the queue, so the buffer can be reused straight away.
+    // The I2C thread retries it up to IS31FL3733_I2C_PERSISTENCE times, like the blocking writes.
+    i2c_transmit_async(addr << 1, data, length, IS31FL3733_I2C_TIMEOUT, IS31FL3733_I2C_PERSISTENCE, is31fl3733_queue_callback, (void *)(uintptr_t)index);
+}
+
+static void is31fl3733_queue_pwm_blocks(uint8_t addr, uint8_t index) {
+    uint8_t *pwm_buffer = g_pwm_buffer[index];
+    uint16_t blocks     = g_pwm_buffer_dirty_blocks[index];
+
+    // Unlock the command register and select PG1 through the queue too, so they stay ahead of the PWM data
+    uint8_t unlock[2] = {IS31FL3733_REG_COMMAND_WRITE_LOCK, IS31FL3733_COMMAND_WRITE_LOCK_MAGIC};
+    uint8_t select[2] = {IS31FL3733_REG_COMMAND, IS31FL3733_COMMAND_PWM};
+    is31fl3733_queue_transfer(addr, index, unlock, 2);
+    is31fl3733_queue_transfer(addr, index, select, 2);
+
+    // Queue the PWM registers of each dirty block in a transfer of 16 bytes
+    for (int i = 0; i < IS31FL3733_PWM_REGISTER_COUNT; i += 16) {
+        if (!(blocks & (1 << (i / 16)))) {
+            continue;
+        }
+
+        g_twi_transfer_buffer[0] = i;
+        memcpy(g_twi_transfer_buffer + 1, pwm_buffer + i, 16);
+        is31fl3733_queue_transfer(addr, index, g_twi_transfer_buffer, 17);
+    }
+}
+
+bool is31fl3733_flush_busy(void) {
+    return i2c_async_busy();
+}
+#endif
+
 void is31fl3733_init_drivers(void) {
     i2c_init();
 
@@ -209,10 +260,10 @@ void is31fl3733_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         if (g_pwm_buffer[led.driver][led.r] == red && g_pwm_buffer[led.driver][led.g] == green && g_pwm_buffer[led.driver][led.b] == blue) {
             return;
         }
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer[led.driver][led.r] = red;
+        g_pwm_buffer[led.driver][led.g] = green;
+        g_pwm_buffer[led.driver][led.b] = blue;
+        g_pwm_buffer_dirty_blocks[led.driver] |= (1 << (led.r / 16)) | (1 << (led.g / 16)) | (1 << (led.b / 16));
     }
 }
 
@@ -253,17 +304,21 @@ void is31fl3733_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void is31fl3733_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
+    if (g_pwm_buffer_dirty_blocks[index]) {
+#ifdef I2C_ASYNC_ENABLE
+        is31fl3733_queue_pwm_blocks(addr, index);
+#else
         // Firstly we need to unlock the command register and select PG1.
         is31fl3733_write_register(addr, IS31FL3733_REG_COMMAND_WRITE_LOCK, IS31FL3733_COMMAND_WRITE_LOCK_MAGIC);
         is31fl3733_write_register(addr, IS31FL3733_REG_COMMAND, IS31FL3733_COMMAND_PWM);
 
         // If any of the transactions fail we risk writing dirty PG0,
         // refresh page 0 just in case.
-        if (!is31fl3733_write_pwm_buffer(addr, g_pwm_buffer[index])) {
+        if (!is31fl3733_write_pwm_blocks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty_blocks[index])) {
             g_led_control_registers_update_required[index] = true;
         }
-        g_pwm_buffer_update_required[index] = false;
+#endif
+        g_pwm_buffer_dirty_blocks[index] = 0;
     }
 }
 
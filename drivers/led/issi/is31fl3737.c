@@ -60,7 +60,8 @@ uint8_t g_twi_transfer_buffer[20];
 // probably not worth the extra complexity.
 
 uint8_t g_pwm_buffer[IS31FL3737_DRIVER_COUNT][IS31FL3737_PWM_REGISTER_COUNT];
-bool    g_pwm_buffer_update_required[IS31FL3737_DRIVER_COUNT] = {false};
+// One bit per 16 byte block of g_pwm_buffer, set when the block changed since the last flush
+uint16_t g_pwm_buffer_dirty_blocks[IS31FL3737_DRIVER_COUNT] = {0};
 
 uint8_t g_led_control_registers[IS31FL3737_DRIVER_COUNT][IS31FL3737_LED_CONTROL_REGISTER_COUNT] = {0};
 bool    g_led_control_registers_update_required[IS31FL3737_DRIVER_COUNT]                        = {false};
@@ -78,14 +79,18 @@ void is31fl3737_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
 #endif
 }
 
-void is31fl3737_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+static void is31fl3737_write_pwm_blocks(uint8_t addr, uint8_t *pwm_buffer, uint16_t blocks) {
     // assumes PG1 is already selected
 
-    // transmit PWM registers in 12 transfers of 16 bytes
+    // transmit the PWM registers of each block in a transfer of 16 bytes
     // g_twi_transfer_buffer[] is 20 bytes
 
-    // iterate over the pwm_buffer contents at 16 byte intervals
+    // iterate over the pwm_buffer contents at 16 byte intervals, skipping clean blocks
     for (int i = 0; i < IS31FL3737_PWM_REGISTER_COUNT; i += 16) {
+        if (!(blocks & (1 << (i / 16)))) {
+            continue;
+        }
+
         g_twi_transfer_buffer[0] = i;
         // copy the data from i to i+15
         // device will auto-increment register for data after the first byte
@@ -102,6 +107,41 @@ void is31fl3737_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
     }
 }
 
+void is31fl3737_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+    is31fl3737_write_pwm_blocks(addr, pwm_buffer, UINT16_MAX);
+}
+
+#ifdef I2C_ASYNC_ENABLE
+static void is31fl3737_queue_transfer(uint8_t addr, uint8_t *data, uint8_t length) {
+    // The data is copied into the queue, so the buffer can be reused straight away.
+    // The I2C thread retries it up to IS31FL3737_I2C_PERSISTENCE times, like the blocking writes.
+    i2c_transmit_async(addr << 1, data, length, IS31FL3737_I2C_TIMEOUT, IS31FL3737_I2C_PERSISTENCE, NULL, NULL);
+}
+
+static void is31fl3737_queue_pwm_blocks(uint8_t addr, uint8_t *pwm_buffer, uint16_t blocks) {
+    // Unlock the command register and select PG1 through the queue too, so they stay ahead of the PWM data
+    uint8_t unlock[2] = {IS31FL3737_REG_COMMAND_WRITE_LOCK, IS31FL3737_COMMAND_WRITE_LOCK_MAGIC};
+    uint8_t select[2] = {IS31FL3737_REG_COMMAND, IS31FL3737_COMMAND_PWM};
+    is31fl3737_queue_transfer(addr, unlock, 2);
+    is31fl3737_queue_transfer(addr, select, 2);
+
+    // Queue the PWM registers of each dirty block in a transfer of 16 bytes
+    for (int i = 0; i < IS31FL3737_PWM_REGISTER_COUNT; i += 16) {
+        if (!(blocks & (1 << (i / 16)))) {
+            continue;
+        }
+
+        g_twi_transfer_buffer[0] = i;
+        memcpy(g_twi_transfer_buffer + 1, pwm_buffer + i, 16);
+        is31fl3737_queue_transfer(addr, g_twi_transfer_buffer, 17);
+    }
+}
+
+bool is31fl3737_flush_busy(void) {
+    return i2c_async_busy();
+}
+#endif
+
 void is31fl3737_init_drivers(void) {
     i2c_init();
 
@@ -185,10 +225,10 @@ void is31fl3737_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         if (g_pwm_buffer[led.driver][led.r] == red && g_pwm_buffer[led.driver][led.g] == green && g_pwm_buffer[led.driver][led.b] == blue) {
             return;
         }
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer[led.driver][led.r] = red;
+        g_pwm_buffer[led.driver][led.g] = green;
+        g_pwm_buffer[led.driver][led.b] = blue;
+        g_pwm_buffer_dirty_blocks[led.driver] |= (1 << (led.r / 16)) | (1 << (led.g / 16)) | (1 << (led.b / 16));
     }
 }
 
@@ -229,13 +269,17 @@ void is31fl3737_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void is31fl3737_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
+    if (g_pwm_buffer_dirty_blocks[index]) {
+#ifdef I2C_ASYNC_ENABLE
+        is31fl3737_queue_pwm_blocks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty_blocks[index]);
+#else
         // Firstly we need to unlock the command register and select PG1
         is31fl3737_write_register(addr, IS31FL3737_REG_COMMAND_WRITE_LOCK, IS31FL3737_COMMAND_WRITE_LOCK_MAGIC);
         is31fl3737_write_register(addr, IS31FL3737_REG_COMMAND, IS31FL3737_COMMAND_PWM);
 
-        is31fl3737_write_pwm_buffer(addr, g_pwm_buffer[index]);
-        g_pwm_buffer_update_required[index] = false;
+        is31fl3737_write_pwm_blocks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty_blocks[index]);
+#endif
+        g_pwm_buffer_dirty_blocks[index] = 0;
     }
 }
 
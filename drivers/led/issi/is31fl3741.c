@@ -62,8 +62,9 @@ uint8_t g_twi_transfer_buffer[20] = {0xFF};
 // buffers and the transfers in is31fl3741_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 uint8_t g_pwm_buffer[IS31FL3741_DRIVER_COUNT][IS31FL3741_PWM_REGISTER_COUNT];
-bool    g_pwm_buffer_update_required[IS31FL3741_DRIVER_COUNT]        = {false};
-bool    g_scaling_registers_update_required[IS31FL3741_DRIVER_COUNT] = {false};
+// One bit per 18 byte block of g_pwm_buffer, set when the block changed since the last flush
+uint32_t g_pwm_buffer_dirty_blocks[IS31FL3741_DRIVER_COUNT]          = {0};
+bool     g_scaling_registers_update_required[IS31FL3741_DRIVER_COUNT] = {false};
 
 uint8_t g_scaling_registers[IS31FL3741_DRIVER_COUNT][IS31FL3741_PWM_REGISTER_COUNT];
 
@@ -80,51 +81,48 @@ void is31fl3741_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
 #endif
 }
 
-bool is31fl3741_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+static bool is31fl3741_write_pwm_blocks(uint8_t addr, uint8_t *pwm_buffer, uint32_t blocks) {
     // Assume PG0 is already selected
+    bool page_1_selected = false;
+
+    // Transmit the PWM registers of each dirty block in a transfer of 18 bytes,
+    // the last block holds the remaining 9 as the total number is 351
+    for (int i = 0; i < IS31FL3741_PWM_REGISTER_COUNT; i += 18) {
+        if (!(blocks & (1UL << (i / 18)))) {
+            continue;
+        }
 
-    for (int i = 0; i < 342; i += 18) {
-        if (i == 180) {
+        if (i >= 180 && !page_1_selected) {
             // unlock the command register and select PG1
             is31fl3741_write_register(addr, IS31FL3741_REG_COMMAND_WRITE_LOCK, IS31FL3741_COMMAND_WRITE_LOCK_MAGIC);
             is31fl3741_write_register(addr, IS31FL3741_REG_COMMAND, IS31FL3741_COMMAND_PWM_1);
+            page_1_selected = true;
         }
 
+        uint8_t length           = MIN(18, IS31FL3741_PWM_REGISTER_COUNT - i);
         g_twi_transfer_buffer[0] = i % 180;
-        memcpy(g_twi_transfer_buffer + 1, pwm_buffer + i, 18);
+        memcpy(g_twi_transfer_buffer + 1, pwm_buffer + i, length);
 
 #if IS31FL3741_I2C_PERSISTENCE > 0
         for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 19, IS31FL3741_I2C_TIMEOUT) != 0) {
+            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, length + 1, IS31FL3741_I2C_TIMEOUT) != 0) {
                 return false;
             }
         }
 #else
-        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 19, IS31FL3741_I2C_TIMEOUT) != 0) {
+        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, length + 1, IS31FL3741_I2C_TIMEOUT) != 0) {
             return false;
         }
 #endif
     }
 
-    // transfer the left cause the total number is 351
-    g_twi_transfer_buffer[0] = 162;
-    memcpy(g_twi_transfer_buffer + 1, pwm_buffer + 342, 9);
-
-#if IS31FL3741_I2C_PERSISTENCE > 0
-    for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 10, IS31FL3741_I2C_TIMEOUT) != 0) {
-            return false;
-        }
-    }
-#else
-    if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 10, IS31FL3741_I2C_TIMEOUT) != 0) {
-        return false;
-    }
-#endif
-
     return true;
 }
 
+bool is31fl3741_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+    return is31fl3741_write_pwm_blocks(addr, pwm_buffer, UINT32_MAX);
+}
+
 void is31fl3741_init_drivers(void) {
     i2c_init();
 
@@ -192,10 +190,10 @@ void is31fl3741_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         if (g_pwm_buffer[led.driver][led.r] == red && g_pwm_buffer[led.driver][led.g] == green && g_pwm_buffer[led.driver][led.b] == blue) {
             return;
         }
-        g_pwm_buffer_update_required[led.driver] = true;
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
+        g_pwm_buffer[led.driver][led.r] = red;
+        g_pwm_buffer[led.driver][led.g] = green;
+        g_pwm_buffer[led.driver][led.b] = blue;
+        g_pwm_buffer_dirty_blocks[led.driver] |= (1UL << (led.r / 18)) | (1UL << (led.g / 18)) | (1UL << (led.b / 18));
     }
 }
 
@@ -231,15 +229,15 @@ void is31fl3741_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void is31fl3741_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
-        // unlock the command register and select PG2
+    if (g_pwm_buffer_dirty_blocks[index]) {
+        // unlock the command register and select PG0
         is31fl3741_write_register(addr, IS31FL3741_REG_COMMAND_WRITE_LOCK, IS31FL3741_COMMAND_WRITE_LOCK_MAGIC);
         is31fl3741_write_register(addr, IS31FL3741_REG_COMMAND, IS31FL3741_COMMAND_PWM_0);
 
-        is31fl3741_write_pwm_buffer(addr, g_pwm_buffer[index]);
+        is31fl3741_write_pwm_blocks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty_blocks[index]);
     }
 
-    g_pwm_buffer_update_required[index] = false;
+    g_pwm_buffer_dirty_blocks[index] = 0;
 }
 
 void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t red, uint8_t green, uint8_t blue) {
@@ -247,7 +245,7 @@ void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t red, uint8_
     g_pwm_buffer[pled->driver][pled->g] = green;
     g_pwm_buffer[pled->driver][pled->b] = blue;
 
-    g_pwm_buffer_update_required[pled->driver] = true;
+    g_pwm_buffer_dirty_blocks[pled->driver] |= (1UL << (pled->r / 18)) | (1UL << (pled->g / 18)) | (1UL << (pled->b / 18));
 }
 
 void is31fl3741_update_led_control_registers(uint8_t addr, uint8_t index) {
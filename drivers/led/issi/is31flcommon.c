@@ -37,7 +37,8 @@ uint8_t g_twi_transfer_buffer[20];
 // These buffers match the PWM & scaling registers.
 // Storing them like this is optimal for I2C transfers to the registers.
 uint8_t g_pwm_buffer[DRIVER_COUNT][ISSI_MAX_LEDS];
-bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
+// One bit per ISSI_PWM_TRF_SIZE byte block of g_pwm_buffer, set when the block changed since the last flush
+uint16_t g_pwm_buffer_dirty_blocks[DRIVER_COUNT] = {0};
 
 uint8_t g_scaling_buffer[DRIVER_COUNT][ISSI_SCALING_SIZE];
 bool    g_scaling_buffer_update_required[DRIVER_COUNT] = {false};
@@ -121,13 +122,17 @@ void IS31FL_common_init(uint8_t addr, uint8_t ssr) {
 }
 
 void IS31FL_common_update_pwm_register(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
+    if (g_pwm_buffer_dirty_blocks[index]) {
         // Queue up the correct page
         IS31FL_unlock_register(addr, ISSI_PAGE_PWM);
-        // Hand off the update to IS31FL_write_multi_registers
-        IS31FL_write_multi_registers(addr, g_pwm_buffer[index], ISSI_MAX_LEDS, ISSI_PWM_TRF_SIZE, ISSI_PWM_REG_1ST);
+        // Hand off each changed block to IS31FL_write_multi_registers, skipping the rest
+        for (int i = 0; i < ISSI_MAX_LEDS; i += ISSI_PWM_TRF_SIZE) {
+            if (g_pwm_buffer_dirty_blocks[index] & (1 << (i / ISSI_PWM_TRF_SIZE))) {
+                IS31FL_write_multi_registers(addr, g_pwm_buffer[index] + i, ISSI_PWM_TRF_SIZE, ISSI_PWM_TRF_SIZE, ISSI_PWM_REG_1ST + i);
+            }
+        }
         // Update flags that pwm_buffer has been updated
-        g_pwm_buffer_update_required[index] = false;
+        g_pwm_buffer_dirty_blocks[index] = 0;
     }
 }
 
@@ -229,10 +234,10 @@ void IS31FL_RGB_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         is31_led led;
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer[led.driver][led.r] = red;
+        g_pwm_buffer[led.driver][led.g] = green;
+        g_pwm_buffer[led.driver][led.b] = blue;
+        g_pwm_buffer_dirty_blocks[led.driver] |= (1 << (led.r / ISSI_PWM_TRF_SIZE)) | (1 << (led.g / ISSI_PWM_TRF_SIZE)) | (1 << (led.b / ISSI_PWM_TRF_SIZE));
     }
 }
 
@@ -318,7 +323,7 @@ void IS31FL_simple_set_brightness(int index, uint8_t value) {
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
         g_pwm_buffer[led.driver][led.v] = value;
-        g_pwm_buffer_update_required[led.driver] = true;
+        g_pwm_buffer_dirty_blocks[led.driver] |= (1 << (led.v / ISSI_PWM_TRF_SIZE));
     }
 }
 
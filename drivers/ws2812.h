@@ -74,3 +74,16 @@
  *         - Wait 50us to reset the LEDs
  */
 void ws2812_setleds(rgb_led_t *ledarray, uint16_t number_of_leds);
+
+#ifdef WS2812_DOUBLE_BUFFER
+#    if !defined(WS2812_SPI) && !defined(WS2812_PWM)
+#        error "WS2812_DOUBLE_BUFFER is only supported by the SPI and PWM drivers"
+#    endif
+
+/*
+ * Whether a frame given to ws2812_setleds() has not been sent in full yet,
+ * as it is being sent or waits for the previous frame to be.
+ * Only the ChibiOS SPI and PWM drivers support double buffering.
+ */
+bool ws2812_frame_in_flight(void);
+#endif
@@ -165,31 +165,40 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
+def make_correction_data(typo: str, correction: str) -> List[int]:
+    """Makes the data to correct one typo: its backspace count, ORed with 128,
+  followed by the null-terminated replacement text.
+  Args:
+    typo: String, the typo as it appears in the dictionary.
+    correction: String, its correction.
+  Returns:
+    List of ints in the range 0-255.
+  """
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    correction = correction[i:]
+    return [backspaces + 128] + list(bytes(correction, 'ascii')) + [0]
+
+
 def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
     """Serializes trie and correction data in a form readable by the C code.
   Args:
     autocorrections: List of (typo, correction) tuples.
     trie: Dict of dicts.
   Returns:
-    List of ints in the range 0-255.
+    List of ints in the range 0-255, or None if the table exceeds 64KB.
   """
     table = []
 
     # Traverse trie in depth first order.
     def traverse(trie_node):
         if 'LEAF' in trie_node:  # Handle a leaf trie node.
-            typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
+            data = make_correction_data(*trie_node['LEAF'])
             entry = {'data': data, 'links': [], 'byte_offset': 0}
             table.append(entry)
         elif len(trie_node) == 1:  # Handle trie node with a single child.
@@ -227,7 +236,8 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     for e in table:  # To encode links, first compute byte offset of each entry.
         e['byte_offset'] = byte_offset
         byte_offset += len(serialize(e))
-        assert 0 <= byte_offset <= 0xffff
+        if byte_offset > 0xffff:
+            return None
 
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
@@ -241,6 +251,116 @@ def encode_link(link: Dict[str, Any]) -> List[int]:
     return [byte_offset & 255, byte_offset >> 8]
 
 
+def make_automaton(autocorrections: List[Tuple[str, str]]) -> Dict[str, Any]:
+    """Makes an Aho-Corasick automaton from the typos, read forwards.
+  States are numbered in breadth first order, except that the states which
+  complete a typo are numbered last. As typos may not be substrings of one
+  another, those states never have transitions of their own.
+  Args:
+    autocorrections: List of (typo, correction) tuples.
+  Returns:
+    Dict of the automaton tables, as lists of ints.
+  """
+    # Build the trie of typos, with node 0 as the root.
+    children = [{}]
+    leaves = {}
+    for typo, correction in autocorrections:
+        node = 0
+        for letter in typo:
+            if letter not in children[node]:
+                children[node][letter] = len(children)
+                children.append({})
+            node = children[node][letter]
+        leaves[node] = (typo, correction)
+
+    # Link every node to the node of its longest proper suffix in the trie.
+    fail = [0] * len(children)
+    order = [0]
+    for node in order:
+        for letter, child in children[node].items():
+            order.append(child)
+            if node:
+                link = fail[node]
+                while link and letter not in children[link]:
+                    link = fail[link]
+                fail[child] = children[link].get(letter, 0)
+
+    order = [node for node in order if node not in leaves] + [node for node in order if node in leaves]
+    if len(order) > 0xffff:
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection automaton is too large, it exceeds 65535 states. Try reducing the autocorrection dict to fewer entries.')
+        sys.exit(1)
+    number = {node: state for state, node in enumerate(order)}
+
+    automaton = {'fail': [], 'edges': [], 'keys': [], 'targets': [], 'matches': [], 'corrections': []}
+    for node in order:
+        automaton['fail'].append(number[fail[node]])
+        if node in leaves:
+            automaton['matches'].append(len(automaton['corrections']))
+            automaton['corrections'] += make_correction_data(*leaves[node])
+        else:
+            automaton['edges'].append(len(automaton['keys']))
+            for key, letter in sorted((TYPO_CHARS[letter], letter) for letter in children[node]):
+                automaton['keys'].append(key)
+                automaton['targets'].append(number[children[node][letter]])
+    automaton['edges'].append(len(automaton['keys']))
+    automaton['boundary'] = number[children[0].get(':', 0)]
+
+    assert len(automaton['corrections']) <= 0xffff
+    return automaton
+
+
+def serialize_flash_image(automaton: Dict[str, Any], min_length: int, max_length: int) -> bytes:
+    """Serializes the automaton into an image for external flash.
+  Each state is a record, identified by its byte offset in the image, so that
+  a transition only reads consecutive bytes. A record starts with the number of
+  transitions, or 0x80 if the state completes a typo, followed by the 24-bit
+  failure link. Transitions follow as a keycode and a 24-bit target state,
+  while the states completing a typo are followed by their correction.
+  Args:
+    automaton: Dict of the automaton tables, from make_automaton().
+    min_length: Length of the shortest typo.
+    max_length: Length of the longest typo.
+  Returns:
+    The image, beginning with a 16 byte header and the root state.
+  """
+    states = len(automaton['fail'])
+    first_match = len(automaton['edges']) - 1
+    corrections = automaton['corrections']
+
+    def correction(state: int) -> List[int]:
+        start = automaton['matches'][state - first_match]
+        return corrections[start:corrections.index(0, start) + 1]
+
+    offsets = []
+    offset = 16
+    for state in range(states):
+        offsets.append(offset)
+        if state < first_match:
+            offset += 4 + 4 * (automaton['edges'][state + 1] - automaton['edges'][state])
+        else:
+            offset += 4 + len(correction(state))
+    if offset > 0xffffff:
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection flash image exceeds the 16MB limit. Try reducing the autocorrection dict to fewer entries.')
+        sys.exit(1)
+
+    def u24(value: int) -> List[int]:
+        return [value & 255, (value >> 8) & 255, value >> 16]
+
+    image = list(b'QACF') + [1, min_length, max_length, 0] + list(offset.to_bytes(4, 'little')) + list(offsets[automaton['boundary']].to_bytes(4, 'little'))
+    for state in range(states):
+        fail = u24(offsets[automaton['fail'][state]])
+        if state < first_match:
+            first, last = automaton['edges'][state], automaton['edges'][state + 1]
+            image += [last - first] + fail
+            for edge in range(first, last):
+                image += [automaton['keys'][edge]] + u24(offsets[automaton['targets'][edge]])
+        else:
+            image += [0x80] + fail + correction(state)
+
+    assert len(image) == offset
+    return bytes(image)
+
+
 def typo_len(e: Tuple[str, str]) -> int:
     return len(e[0])
 
@@ -253,6 +373,7 @@ def to_hex(b: int) -> str:
 @cli.argument('-kb', '--keyboard', type=keyboard_folder, completer=keyboard_completer, help='The keyboard to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
+@cli.argument('-f', '--flash-image', arg_only=True, type=normpath, help='Also write the automaton as an image for external flash to this file')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
@@ -266,7 +387,10 @@ def generate_autocorrect_data(cli):
     if current_keyboard and current_keymap:
         cli.args.output = locate_keymap(current_keyboard, current_keymap).parent / 'autocorrect_data.h'
 
-    assert all(0 <= b <= 255 for b in data)
+    if data is None:
+        cli.log.warning('{fg_yellow}Warning:{fg_reset} The autocorrection trie exceeds the 64KB limit, only the automaton is generated. Add "#define AUTOCORRECT_AUTOMATON" to your config.h to use it.')
+    else:
+        assert all(0 <= b <= 255 for b in data)
 
     min_typo = min(autocorrections, key=typo_len)[0]
     max_typo = max(autocorrections, key=typo_len)[0]
@@ -281,11 +405,46 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
-    autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    if data is not None:
+        autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
     autocorrect_data_h_lines.append('')
-    autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
-    autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
-    autocorrect_data_h_lines.append('};')
+
+    # The automaton is an alternative encoding of the same dictionary, selected with AUTOCORRECT_AUTOMATON.
+    automaton = make_automaton(autocorrections)
+    states = len(automaton['fail'])
+    matches = len(automaton['matches'])
+    edges = len(automaton['keys'])
+
+    autocorrect_data_h_lines.append('#ifdef AUTOCORRECT_AUTOMATON')
+    autocorrect_data_h_lines.append(f'#    define AUTOCORRECT_AUTOMATON_STATES {states}')
+    autocorrect_data_h_lines.append(f'#    define AUTOCORRECT_AUTOMATON_FIRST_MATCH {states - matches}')
+    autocorrect_data_h_lines.append(f'#    define AUTOCORRECT_AUTOMATON_BOUNDARY {automaton["boundary"]}')
+    autocorrect_data_h_lines.append(f'#    define AUTOCORRECT_AUTOMATON_EDGES {edges}')
+    autocorrect_data_h_lines.append(f'#    define AUTOCORRECT_AUTOMATON_CORRECTIONS_SIZE {len(automaton["corrections"])}')
+    for name, ctype, size in (
+        ('fail', 'uint16_t', 'AUTOCORRECT_AUTOMATON_STATES'),
+        ('edges', 'uint16_t', 'AUTOCORRECT_AUTOMATON_FIRST_MATCH + 1'),
+        ('keys', 'uint8_t', 'AUTOCORRECT_AUTOMATON_EDGES'),
+        ('targets', 'uint16_t', 'AUTOCORRECT_AUTOMATON_EDGES'),
+        ('matches', 'uint16_t', 'AUTOCORRECT_AUTOMATON_STATES - AUTOCORRECT_AUTOMATON_FIRST_MATCH'),
+        ('corrections', 'uint8_t', 'AUTOCORRECT_AUTOMATON_CORRECTIONS_SIZE'),
+    ):
+        autocorrect_data_h_lines.append('')
+        autocorrect_data_h_lines.append(f'static const {ctype} autocorrect_automaton_{name}[{size}] PROGMEM = {{')
+        autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(str, automaton[name]))), width=100, subsequent_indent='    '))
+        autocorrect_data_h_lines.append('};')
+    autocorrect_data_h_lines.append('#else')
+    if data is None:
+        autocorrect_data_h_lines.append('#    error "The autocorrection dictionary is too large for the trie, define AUTOCORRECT_AUTOMATON to use it"')
+    else:
+        autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
+        autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
+        autocorrect_data_h_lines.append('};')
+    autocorrect_data_h_lines.append('#endif')
+
+    if cli.args.flash_image:
+        with open(cli.args.flash_image, 'wb') as image:
+            image.write(serialize_flash_image(automaton, len(min_typo), len(max_typo)))
 
     # Show the results
     dump_lines(cli.args.output, autocorrect_data_h_lines, cli.args.quiet)
@@ -0,0 +1,26 @@
+from itertools import product
+
+from qmk.cli.generate.autocorrect_data import make_automaton, make_trie, serialize_trie
+
+
+def make_autocorrections(count):
+    """Makes typos which are not substrings of one another, each with a long correction."""
+    typos = [''.join(letters) for letters in product('abcdefgh', repeat=4)][:count]
+    return [(typo, 'z' * 12) for typo in typos]
+
+
+def test_serialize_trie():
+    autocorrections = make_autocorrections(64)
+    data = serialize_trie(autocorrections, make_trie(autocorrections))
+    assert data is not None
+    assert len(data) <= 0xffff
+    assert all(0 <= b <= 255 for b in data)
+
+
+def test_serialize_trie_too_large():
+    autocorrections = make_autocorrections(4096)
+    assert serialize_trie(autocorrections, make_trie(autocorrections)) is None
+
+    # The automaton still encodes the dictionary
+    automaton = make_automaton(autocorrections)
+    assert len(automaton['matches']) == len(autocorrections)
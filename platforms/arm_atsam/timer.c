@@ -30,6 +30,25 @@ uint32_t timer_elapsed32(uint32_t tlast) {
     return TIMER_DIFF_32(timer_read32(), tlast);
 }
 
+uint32_t timer_read_hires(void) {
+    // TC4 counts microseconds within the current millisecond, see CLK_enable_timebase()
+    uint64_t ms;
+    uint16_t us;
+    do {
+        ms                            = ms_clk;
+        TC4->COUNT16.CTRLBSET.bit.CMD = TC_CTRLBSET_CMD_READSYNC_Val;
+        while (TC4->COUNT16.SYNCBUSY.bit.CTRLB || TC4->COUNT16.SYNCBUSY.bit.COUNT) {
+        }
+        us = TC4->COUNT16.COUNT.reg;
+    } while (ms != ms_clk);
+
+    return (uint32_t)ms * 1000 + us;
+}
+
+uint32_t timer_hires_frequency(void) {
+    return FREQ_TC45_DEFAULT;
+}
+
 void timer_clear(void) {
     set_time(0);
 }
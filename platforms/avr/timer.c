@@ -134,6 +134,38 @@ inline uint32_t timer_elapsed32(uint32_t last) {
     return TIMER_DIFF_32(t, last);
 }
 
+#if defined(__AVR_ATmega32A__)
+#    define TIMER_COMPARE_FLAG_REG TIFR
+#    define TIMER_COMPARE_FLAG OCF0
+#elif defined(__AVR_ATtiny85__)
+#    define TIMER_COMPARE_FLAG_REG TIFR
+#    define TIMER_COMPARE_FLAG OCF0A
+#else
+#    define TIMER_COMPARE_FLAG_REG TIFR0
+#    define TIMER_COMPARE_FLAG OCF0A
+#endif
+
+uint32_t timer_read_hires(void) {
+    uint32_t t;
+    uint8_t  raw;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        t   = timer_count;
+        raw = TIMER_RAW;
+        // Account for a compare match that occurred but has not been serviced yet
+        if (TIMER_COMPARE_FLAG_REG & _BV(TIMER_COMPARE_FLAG)) {
+            t++;
+            raw = TIMER_RAW;
+        }
+    }
+
+    return t * (TIMER_RAW_TOP + 1) + raw;
+}
+
+uint32_t timer_hires_frequency(void) {
+    return TIMER_RAW_FREQ;
+}
+
 // excecuted once per 1ms.(excess for just timer count?)
 #ifndef __AVR_ATmega32A__
 #    define TIMER_INTERRUPT_VECTOR TIMER0_COMPA_vect
@@ -90,6 +90,18 @@
 #    endif
 #endif
 
+#ifdef I2C_ASYNC_ENABLE
+#    ifndef I2C_ASYNC_QUEUE_SIZE
+#        define I2C_ASYNC_QUEUE_SIZE 32
+#    endif
+#    ifndef I2C_ASYNC_MAX_LENGTH
+#        define I2C_ASYNC_MAX_LENGTH 20
+#    endif
+#    if I2C_ASYNC_MAX_LENGTH > 255
+#        error "I2C_ASYNC_MAX_LENGTH must not be larger than 255"
+#    endif
+#endif
+
 static uint8_t i2c_address;
 
 static const I2CConfig i2cconfig = {
@@ -125,11 +137,120 @@ static i2c_status_t i2c_epilogue(const msg_t status) {
     // From ChibiOS HAL: "After a timeout the driver must be stopped and
     // restarted because the bus is in an uncertain state." We also issue that
     // hard stop in case of any error.
-    i2c_stop();
+    i2cStop(&I2C_DRIVER);
 
     return status == MSG_TIMEOUT ? I2C_STATUS_TIMEOUT : I2C_STATUS_ERROR;
 }
 
+#ifdef I2C_ASYNC_ENABLE
+typedef struct {
+    uint8_t              address;
+    uint8_t              length;
+    uint16_t             timeout;
+    uint8_t              attempts;
+    i2c_async_callback_t callback;
+    void*                context;
+    uint8_t              data[I2C_ASYNC_MAX_LENGTH];
+} i2c_async_transfer_t;
+
+static i2c_async_transfer_t i2c_async_queue[I2C_ASYNC_QUEUE_SIZE];
+static uint8_t              i2c_async_head = 0;
+static uint8_t              i2c_async_tail = 0;
+// Counts the queued transfers, and the slots which are neither queued nor being sent
+static semaphore_t i2c_async_pending;
+static semaphore_t i2c_async_free;
+
+/**
+ * @brief Sends the queued transfers in order. The thread sleeps while the I2C
+ * driver runs each transfer from its interrupts and DMA, so the main loop
+ * carries on in the meantime.
+ */
+static THD_WORKING_AREA(waI2CAsyncThread, 256);
+static THD_FUNCTION(I2CAsyncThread, arg) {
+    (void)arg;
+    chRegSetThreadName("i2c_async");
+
+    while (true) {
+        chSemWait(&i2c_async_pending);
+
+        i2c_async_transfer_t* transfer = &i2c_async_queue[i2c_async_tail];
+        i2c_status_t          result;
+        uint8_t               attempt = 0;
+        do {
+            i2cStart(&I2C_DRIVER, &i2cconfig);
+            msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (transfer->address >> 1), transfer->data, transfer->length, 0, 0, TIME_MS2I(transfer->timeout));
+            result       = i2c_epilogue(status);
+        } while (result != I2C_STATUS_SUCCESS && ++attempt < transfer->attempts);
+        if (transfer->callback) {
+            transfer->callback(result, transfer->context);
+        }
+
+        i2c_async_tail = (i2c_async_tail + 1) % I2C_ASYNC_QUEUE_SIZE;
+        chSemSignal(&i2c_async_free);
+    }
+}
+
+static void i2c_async_init(void) {
+    static bool is_initialised = false;
+    if (!is_initialised) {
+        is_initialised = true;
+
+        chSemObjectInit(&i2c_async_pending, 0);
+        chSemObjectInit(&i2c_async_free, I2C_ASYNC_QUEUE_SIZE);
+        // Above the main loop, so the next transfer starts as soon as the previous one completes
+        chThdCreateStatic(waI2CAsyncThread, sizeof(waI2CAsyncThread), NORMALPRIO + 1, I2CAsyncThread, NULL);
+    }
+}
+
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout, uint8_t attempts, i2c_async_callback_t callback, void* context) {
+    if (length > I2C_ASYNC_MAX_LENGTH) {
+        return I2C_STATUS_ERROR;
+    }
+    i2c_async_init();
+
+    // Only blocks when the queue is full, until the oldest transfer completes
+    chSemWait(&i2c_async_free);
+
+    i2c_async_transfer_t* transfer = &i2c_async_queue[i2c_async_head];
+    transfer->address              = address;
+    transfer->length               = length;
+    transfer->timeout              = timeout;
+    transfer->attempts             = attempts;
+    transfer->callback             = callback;
+    transfer->context              = context;
+    memcpy(transfer->data, data, length);
+
+    i2c_async_head = (i2c_async_head + 1) % I2C_ASYNC_QUEUE_SIZE;
+    chSemSignal(&i2c_async_pending);
+    return I2C_STATUS_SUCCESS;
+}
+
+bool i2c_async_busy(void) {
+    i2c_async_init();
+
+    chSysLock();
+    cnt_t free_slots = chSemGetCounterI(&i2c_async_free);
+    chSysUnlock();
+    return free_slots < I2C_ASYNC_QUEUE_SIZE;
+}
+
+void i2c_async_wait(void) {
+    while (i2c_async_busy()) {
+        chThdSleep(1);
+    }
+}
+#endif
+
+/**
+ * @brief Lets the queued asynchronous transfers complete, so that blocking
+ * transfers keep their order on the bus and never run alongside them.
+ */
+static inline void i2c_sync_prologue(void) {
+#ifdef I2C_ASYNC_ENABLE
+    i2c_async_wait();
+#endif
+}
+
 __attribute__((weak)) void i2c_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -151,12 +272,14 @@ __attribute__((weak)) void i2c_init(void) {
 }
 
 i2c_status_t i2c_start(uint8_t address) {
+    i2c_sync_prologue();
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     return I2C_STATUS_SUCCESS;
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_sync_prologue();
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
@@ -164,6 +287,7 @@ i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length,
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_sync_prologue();
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, TIME_MS2I(timeout));
@@ -171,6 +295,7 @@ i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16
 }
 
 i2c_status_t i2c_writeReg(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_sync_prologue();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
 
@@ -185,6 +310,7 @@ i2c_status_t i2c_writeReg(uint8_t devaddr, uint8_t regaddr, const uint8_t* data,
 }
 
 i2c_status_t i2c_writeReg16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_sync_prologue();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
 
@@ -200,6 +326,7 @@ i2c_status_t i2c_writeReg16(uint8_t devaddr, uint16_t regaddr, const uint8_t* da
 }
 
 i2c_status_t i2c_readReg(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_sync_prologue();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
@@ -207,6 +334,7 @@ i2c_status_t i2c_readReg(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16
 }
 
 i2c_status_t i2c_readReg16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_sync_prologue();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
@@ -215,5 +343,6 @@ i2c_status_t i2c_readReg16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uin
 }
 
 void i2c_stop(void) {
+    i2c_sync_prologue();
     i2cStop(&I2C_DRIVER);
 }
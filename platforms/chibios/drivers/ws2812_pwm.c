@@ -1,6 +1,7 @@
 #include "ws2812.h"
 #include "gpio.h"
 #include "chibios_config.h"
+#include <string.h>
 
 /* Adapted from https://github.com/joewa/WS2812-LED-Driver_ChibiOS/ */
 
@@ -28,6 +29,9 @@
 #if (STM32_DMA_SUPPORTS_DMAMUX == TRUE) && !defined(WS2812_DMAMUX_ID)
 #    error "please consult your MCU's datasheet and specify in your config.h: #define WS2812_DMAMUX_ID STM32_DMAMUX1_TIM?_UP"
 #endif
+#if defined(WS2812_DOUBLE_BUFFER) && (defined(WB32F3G71xx) || defined(WB32FQ95xx))
+#    error "WS2812_DOUBLE_BUFFER is not supported by the PWM driver on WB32"
+#endif
 
 /* Summarize https://www.st.com/resource/en/application_note/an4013-stm32-crossseries-timer-overview-stmicroelectronics.pdf to
  * figure out if we are using a 32bit timer. This is needed to setup the DMA controller correctly.
@@ -291,14 +295,61 @@ typedef uint16_t ws2812_buffer_t;
 typedef uint8_t ws2812_buffer_t;
 #endif
 
+#ifdef WS2812_DOUBLE_BUFFER
+static ws2812_buffer_t  ws2812_frame_buffers[2][WS2812_BIT_N + 1];     /**< Buffers for a frame, one is sent while the other is written */
+static ws2812_buffer_t* ws2812_frame_buffer = ws2812_frame_buffers[0]; /**< The buffer being written, the DMA reads the other one */
+static volatile bool    ws2812_pending      = false;                   /**< The written buffer holds a frame waiting for the end of the current one */
+static volatile bool    ws2812_sending      = false;                   /**< The frame which was swapped in last has not been sent in full yet */
+#    define WS2812_DMA_MODE_DOUBLE_BUFFER STM32_DMA_CR_TCIE
+#else
 static ws2812_buffer_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
+#    define WS2812_DMA_MODE_DOUBLE_BUFFER 0
+#endif
 
-/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
-/*
- * Gedanke: Double-buffer type transactions: double buffer transfers using two memory pointers for
- * the memory (while the DMA is reading/writing from/to a buffer, the application can
- * write/read to/from the other buffer).
+#define WS2812_DMA_MODE (STM32_DMA_CR_CHSEL(WS2812_DMA_CHANNEL) | STM32_DMA_CR_DIR_M2P | WS2812_DMA_PERIPHERAL_WIDTH | WS2812_DMA_MEMORY_WIDTH | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_PL(3) | WS2812_DMA_MODE_DOUBLE_BUFFER)
+
+/* --- PRIVATE FUNCTIONS ---------------------------------------------------- */
+
+#ifdef WS2812_DOUBLE_BUFFER
+/**
+ * @brief   Swaps the frame buffers once the DMA has sent the whole current one
+ *
+ * The transfer complete interrupt fires as the circular DMA wraps around, right after the
+ * reset bits. Restarting the stream on the other buffer here cannot tear a frame: should the
+ * next request be serviced late, the line only stays low for one more reset bit.
  */
+static void ws2812_dma_isr(void* param, uint32_t flags) {
+    (void)param;
+    if (!(flags & STM32_DMA_ISR_TCIF)) {
+        return;
+    }
+
+    osalSysLockFromISR();
+    if (ws2812_pending) {
+        ws2812_buffer_t* front = ws2812_frame_buffer;
+        ws2812_frame_buffer    = (front == ws2812_frame_buffers[0]) ? ws2812_frame_buffers[1] : ws2812_frame_buffers[0];
+        ws2812_pending         = false;
+        ws2812_sending         = true;
+
+        dmaStreamDisable(WS2812_DMA_STREAM);
+        dmaStreamSetMemory0(WS2812_DMA_STREAM, front);
+        dmaStreamSetTransactionSize(WS2812_DMA_STREAM, WS2812_BIT_N);
+        dmaStreamSetMode(WS2812_DMA_STREAM, WS2812_DMA_MODE);
+        dmaStreamEnable(WS2812_DMA_STREAM);
+    } else {
+        ws2812_sending = false;
+    }
+    osalSysUnlockFromISR();
+}
+
+bool ws2812_frame_in_flight(void) {
+    return ws2812_sending || ws2812_pending;
+}
+#else
+#    define ws2812_dma_isr NULL
+#endif
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 
 void ws2812_init(void) {
     // Initialize led frame buffer
@@ -307,6 +358,10 @@ void ws2812_init(void) {
         ws2812_frame_buffer[i] = WS2812_DUTYCYCLE_0; // All color bits are zero duty cycle
     for (i = 0; i < WS2812_RESET_BIT_N; i++)
         ws2812_frame_buffer[i + WS2812_COLOR_BIT_N] = 0; // All reset bits are zero
+#ifdef WS2812_DOUBLE_BUFFER
+    // Send from the other buffer, the first frame is written into this one
+    memcpy(ws2812_frame_buffers[1], ws2812_frame_buffers[0], sizeof(ws2812_frame_buffers[0]));
+#endif
 
     palSetLineMode(WS2812_DI_PIN, WS2812_OUTPUT_MODE);
 
@@ -334,10 +389,14 @@ void ws2812_init(void) {
     dmaStreamSetDestination(WS2812_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
     dmaStreamSetMode(WS2812_DMA_STREAM, WB32_DMA_CHCFG_HWHIF(WS2812_DMA_CHANNEL) | WB32_DMA_CHCFG_DIR_M2P | WB32_DMA_CHCFG_PSIZE_WORD | WB32_DMA_CHCFG_MSIZE_WORD | WB32_DMA_CHCFG_MINC | WB32_DMA_CHCFG_CIRC | WB32_DMA_CHCFG_TCIE | WB32_DMA_CHCFG_PL(3));
 #else
-    dmaStreamAlloc(WS2812_DMA_STREAM - STM32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamAlloc(WS2812_DMA_STREAM - STM32_DMA_STREAM(0), 10, ws2812_dma_isr, NULL);
     dmaStreamSetPeripheral(WS2812_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
+#    ifdef WS2812_DOUBLE_BUFFER
+    dmaStreamSetMemory0(WS2812_DMA_STREAM, ws2812_frame_buffers[1]);
+#    else
     dmaStreamSetMemory0(WS2812_DMA_STREAM, ws2812_frame_buffer);
-    dmaStreamSetMode(WS2812_DMA_STREAM, STM32_DMA_CR_CHSEL(WS2812_DMA_CHANNEL) | STM32_DMA_CR_DIR_M2P | WS2812_DMA_PERIPHERAL_WIDTH | WS2812_DMA_MEMORY_WIDTH | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_PL(3));
+#    endif
+    dmaStreamSetMode(WS2812_DMA_STREAM, WS2812_DMA_MODE);
 #endif
     dmaStreamSetTransactionSize(WS2812_DMA_STREAM, WS2812_BIT_N);
     // M2P: Memory 2 Periph; PL: Priority Level
@@ -386,6 +445,13 @@ void ws2812_setleds(rgb_led_t* ledarray, uint16_t leds) {
         s_init = true;
     }
 
+#ifdef WS2812_DOUBLE_BUFFER
+    // A frame still waiting to be swapped in is replaced by this one
+    osalSysLock();
+    ws2812_pending = false;
+    osalSysUnlock();
+#endif
+
     for (uint16_t i = 0; i < leds; i++) {
 #ifdef RGBW
         ws2812_write_led_rgbw(i, ledarray[i].r, ledarray[i].g, ledarray[i].b, ledarray[i].w);
@@ -393,4 +459,11 @@ void ws2812_setleds(rgb_led_t* ledarray, uint16_t leds) {
         ws2812_write_led(i, ledarray[i].r, ledarray[i].g, ledarray[i].b);
 #endif
     }
+
+#ifdef WS2812_DOUBLE_BUFFER
+    // The DMA interrupt swaps it in once the current frame has been sent
+    osalSysLock();
+    ws2812_pending = true;
+    osalSysUnlock();
+#endif
 }
@@ -69,6 +69,15 @@
 #    define WS2812_SPI_BUFFER_MODE 0 // normal buffer
 #endif
 
+#ifdef WS2812_DOUBLE_BUFFER
+#    if defined(WS2812_SPI_USE_CIRCULAR_BUFFER) || defined(WS2812_SPI_SYNC)
+#        error "WS2812_DOUBLE_BUFFER cannot be used with WS2812_SPI_USE_CIRCULAR_BUFFER or WS2812_SPI_SYNC"
+#    endif
+#    define WS2812_SPI_END_CB ws2812_spi_end_cb
+#else
+#    define WS2812_SPI_END_CB NULL
+#endif
+
 #if defined(USE_GPIOV1)
 #    define WS2812_SCK_OUTPUT_MODE PAL_MODE_ALTERNATE_PUSHPULL
 #else
@@ -86,7 +95,16 @@
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
 
+#ifdef WS2812_DOUBLE_BUFFER
+static uint8_t txbufs[2][PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+// The back buffer, frames are encoded into it while the other one is sent
+static uint8_t* txbuf = txbufs[0];
+// Whether the back buffer holds a frame waiting for the current send to complete
+static volatile bool ws2812_pending = false;
+static volatile bool ws2812_sending = false;
+#else
 static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+#endif
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
@@ -137,6 +155,37 @@ static void set_led_color_rgb(rgb_led_t color, int pos) {
 #endif
 }
 
+#ifdef WS2812_DOUBLE_BUFFER
+/*
+ * Swaps the buffers and starts sending the frame which was just encoded.
+ * Must be called with the system locked, and never while a send is running.
+ */
+static void ws2812_send_back_buffer_i(void) {
+    uint8_t* front = txbuf;
+    txbuf          = (front == txbufs[0]) ? txbufs[1] : txbufs[0];
+    ws2812_pending = false;
+    ws2812_sending = true;
+    spiStartSendI(&WS2812_SPI_DRIVER, sizeof(txbufs[0]), front);
+}
+
+// Runs from the SPI interrupt once a frame has been sent, and sends the pending one if any.
+// ChibiOS lets the end callback start the next operation.
+static void ws2812_spi_end_cb(SPIDriver* spip) {
+    (void)spip;
+    chSysLockFromISR();
+    if (ws2812_pending) {
+        ws2812_send_back_buffer_i();
+    } else {
+        ws2812_sending = false;
+    }
+    chSysUnlockFromISR();
+}
+
+bool ws2812_frame_in_flight(void) {
+    return ws2812_sending || ws2812_pending;
+}
+#endif
+
 void ws2812_init(void) {
     palSetLineMode(WS2812_DI_PIN, WS2812_MOSI_OUTPUT_MODE);
 
@@ -151,7 +200,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_END_CB, // end_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
@@ -170,7 +219,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
+        WS2812_SPI_END_CB, // data_cb
         NULL, // error_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
@@ -194,13 +243,29 @@ void ws2812_setleds(rgb_led_t* ledarray, uint16_t leds) {
         s_init = true;
     }
 
+#ifdef WS2812_DOUBLE_BUFFER
+    // A frame still waiting in the back buffer is replaced by this one
+    chSysLock();
+    ws2812_pending = false;
+    chSysUnlock();
+#endif
+
     for (uint8_t i = 0; i < leds; i++) {
         set_led_color_rgb(ledarray[i], i);
     }
 
+#ifdef WS2812_DOUBLE_BUFFER
+    // Send now if the bus is idle, otherwise the end of the current send picks the frame up
+    chSysLock();
+    if (ws2812_sending) {
+        ws2812_pending = true;
+    } else {
+        ws2812_send_back_buffer_i();
+    }
+    chSysUnlock();
+#elif !defined(WS2812_SPI_USE_CIRCULAR_BUFFER)
     // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
     // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
-#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
 #    ifdef WS2812_SPI_SYNC
     spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
 #    else
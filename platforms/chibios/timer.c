@@ -1,6 +1,7 @@
 #include <ch.h>
 
 #include "timer.h"
+#include "chibios_config.h"
 
 static uint32_t ticks_offset = 0;
 static uint32_t last_ticks   = 0;
@@ -105,3 +106,23 @@ uint16_t timer_elapsed(uint16_t last) {
 uint32_t timer_elapsed32(uint32_t last) {
     return TIMER_DIFF_32(timer_read32(), last);
 }
+
+uint32_t timer_read_hires(void) {
+#if PORT_SUPPORTS_RT == TRUE
+    return chSysGetRealtimeCounterX();
+#else
+    // No realtime counter available (e.g. Cortex-M0), fall back to the system tick counter.
+    chSysLock();
+    uint32_t ticks = get_system_time_ticks();
+    chSysUnlock();
+    return ticks;
+#endif
+}
+
+uint32_t timer_hires_frequency(void) {
+#if PORT_SUPPORTS_RT == TRUE
+    return REALTIME_COUNTER_CLOCK;
+#else
+    return CH_CFG_ST_FREQUENCY;
+#endif
+}
@@ -6,3 +6,7 @@
 // Generate out-of-line copies for inline functions defined in timer.h.
 extern inline fast_timer_t timer_read_fast(void);
 extern inline fast_timer_t timer_elapsed_fast(fast_timer_t last);
+
+uint32_t timer_hires_to_us(uint32_t ticks) {
+    return (uint32_t)(((uint64_t)ticks * 1000000) / timer_hires_frequency());
+}
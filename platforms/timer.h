@@ -43,6 +43,14 @@ uint32_t timer_read32(void);
 uint16_t timer_elapsed(uint16_t last);
 uint32_t timer_elapsed32(uint32_t last);
 
+// High resolution free-running counter, intended for profiling and latency measurement.
+// The value wraps at 32 bits, so durations must be computed with TIMER_DIFF_32().
+uint32_t timer_read_hires(void);
+// Frequency in Hz of the counter returned by timer_read_hires().
+uint32_t timer_hires_frequency(void);
+// Converts a duration in timer_read_hires() ticks to microseconds.
+uint32_t timer_hires_to_us(uint32_t ticks);
+
 // Utility functions to check if a future time has expired & autmatically handle time wrapping if checked / reset frequently (half of max value)
 #define timer_expired(current, future) ((uint16_t)(current - future) < UINT16_MAX / 2)
 #define timer_expired32(current, future) ((uint32_t)(current - future) < UINT32_MAX / 2)
@@ -520,6 +520,7 @@ void process_action(keyrecord_t *record, action_t action) {
                     } else {
                         if (tap_count > 0) {
                             ac_dprintf("MODS_TAP: Tap: unregister_code\n");
+                            flush_keyboard_report();
                             if (action.layer_tap.code == KC_CAPS_LOCK) {
                                 wait_ms(TAP_HOLD_CAPS_DELAY);
                             } else {
@@ -702,6 +703,7 @@ void process_action(keyrecord_t *record, action_t action) {
                     } else {
                         if (tap_count > 0) {
                             ac_dprintf("KEYMAP_TAP_KEY: Tap: unregister_code\n");
+                            flush_keyboard_report();
                             if (action.layer_tap.code == KC_CAPS_LOCK) {
                                 wait_ms(TAP_HOLD_CAPS_DELAY);
                             } else {
@@ -719,6 +721,7 @@ void process_action(keyrecord_t *record, action_t action) {
                         register_code(action.layer_tap.code);
                     } else {
                         ac_dprintf("KEYMAP_TAP_KEY: Tap: unregister_code\n");
+                        flush_keyboard_report();
                         if (action.layer_tap.code == KC_CAPS) {
                             wait_ms(TAP_HOLD_CAPS_DELAY);
                         } else {
@@ -792,6 +795,7 @@ void process_action(keyrecord_t *record, action_t action) {
                         if (event.pressed) {
                             register_code(action.swap.code);
                         } else {
+                            flush_keyboard_report();
                             wait_ms(TAP_CODE_DELAY);
                             unregister_code(action.swap.code);
                             *record = (keyrecord_t){}; // hack: reset tap mode
@@ -893,6 +897,7 @@ __attribute__((weak)) void register_code(uint8_t code) {
 #    endif
         add_key(KC_CAPS_LOCK);
         send_keyboard_report();
+        flush_keyboard_report();
         wait_ms(TAP_HOLD_CAPS_DELAY);
         del_key(KC_CAPS_LOCK);
         send_keyboard_report();
@@ -903,6 +908,7 @@ __attribute__((weak)) void register_code(uint8_t code) {
 #    endif
         add_key(KC_NUM_LOCK);
         send_keyboard_report();
+        flush_keyboard_report();
         wait_ms(100);
         del_key(KC_NUM_LOCK);
         send_keyboard_report();
@@ -913,6 +919,7 @@ __attribute__((weak)) void register_code(uint8_t code) {
 #    endif
         add_key(KC_SCROLL_LOCK);
         send_keyboard_report();
+        flush_keyboard_report();
         wait_ms(100);
         del_key(KC_SCROLL_LOCK);
         send_keyboard_report();
@@ -1011,6 +1018,10 @@ __attribute__((weak)) void unregister_code(uint8_t code) {
  */
 __attribute__((weak)) void tap_code_delay(uint8_t code, uint16_t delay) {
     register_code(code);
+    if (delay > 0) {
+        // Make sure the press reaches the host before waiting, rather than along with the release
+        flush_keyboard_report();
+    }
     for (uint16_t i = delay; i > 0; i--) {
         wait_ms(1);
     }
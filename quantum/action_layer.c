@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -316,6 +317,51 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_OPACITY_CACHE)
+/** \brief Transparency of each matrix position, per layer
+ *
+ * A layer is only looked up the first time it needs to be checked for a position, after which its bit in
+ * resolved_layers is set and its bit in opaque_layers tells whether the position is not transparent on it.
+ */
+static layer_state_t resolved_layers[MATRIX_ROWS][MATRIX_COLS];
+static layer_state_t opaque_layers[MATRIX_ROWS][MATRIX_COLS];
+
+void layer_opacity_cache_invalidate(void) {
+    memset(resolved_layers, 0, sizeof(resolved_layers));
+}
+
+void layer_opacity_cache_invalidate_key(uint8_t row, uint8_t col) {
+    if (row < MATRIX_ROWS && col < MATRIX_COLS) {
+        resolved_layers[row][col] = 0;
+    }
+}
+
+static uint8_t layer_opacity_cache_get_layer(keypos_t key, layer_state_t layers) {
+    layer_state_t *resolved = &resolved_layers[key.row][key.col];
+    layer_state_t *opaque   = &opaque_layers[key.row][key.col];
+
+    while (true) {
+        /* skip the active layers on which the key is already known to be transparent */
+        layer_state_t candidates = layers & ~(*resolved & ~*opaque);
+        if (!candidates) {
+            return 0;
+        }
+
+        uint8_t       layer = get_highest_layer(candidates);
+        layer_state_t mask  = (layer_state_t)1 << layer;
+        if (!(*resolved & mask)) {
+            *resolved |= mask;
+            if (action_for_key(layer, key).code == ACTION_TRANSPARENT) {
+                *opaque &= ~mask;
+                continue;
+            }
+            *opaque |= mask;
+        }
+        return layer;
+    }
+}
+#endif
+
 /** \brief Layer switch get layer
  *
  * Gets the layer based on key info
@@ -326,6 +372,11 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     action.code = ACTION_TRANSPARENT;
 
     layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_OPACITY_CACHE
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        return layer_opacity_cache_get_layer(key, layers);
+    }
+#    endif
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
@@ -161,6 +161,11 @@ layer_state_t update_tri_layer_state(layer_state_t state, uint8_t layer1, uint8_
 void    update_source_layers_cache(keypos_t key, uint8_t layer);
 uint8_t read_source_layers_cache(keypos_t key);
 #endif
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_OPACITY_CACHE)
+/* forget which layers are transparent, for every key or for one matrix position */
+void layer_opacity_cache_invalidate(void);
+void layer_opacity_cache_invalidate_key(uint8_t row, uint8_t col);
+#endif
 action_t store_or_get_action(bool pressed, keypos_t key);
 
 /* return the topmost non-transparent layer currently associated with key */
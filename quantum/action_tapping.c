@@ -59,10 +59,16 @@ __attribute__((weak)) bool get_hold_on_other_key_press(uint16_t keycode, keyreco
 #        include "process_auto_shift.h"
 #    endif
 
+#    if WAITING_BUFFER_SIZE < 2 || WAITING_BUFFER_SIZE > 255
+#        error "WAITING_BUFFER_SIZE must be between 2 and 255"
+#    endif
+
 static keyrecord_t tapping_key                         = {};
 static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
+// Number of press events in waiting_buffer, the others are releases
+static uint8_t waiting_buffer_presses = 0;
 
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
@@ -78,6 +84,20 @@ static void debug_waiting_buffer(void);
  * FIXME: Needs doc
  */
 void action_tapping_process(keyrecord_t record) {
+    // With no tapping key and nothing waiting, only the press of a tap key needs the state machine
+    if (IS_NOEVENT(tapping_key.event) && waiting_buffer_head == waiting_buffer_tail) {
+        if (!IS_EVENT(record.event)) {
+            return;
+        }
+        if (!record.event.pressed || !is_tap_record(&record)) {
+            process_record(&record);
+            ac_dprintf("processed: ");
+            debug_record(record);
+            ac_dprintf("\n\n");
+            return;
+        }
+    }
+
     if (process_tapping(&record)) {
         if (IS_EVENT(record.event)) {
             ac_dprintf("processed: ");
@@ -103,6 +123,9 @@ void action_tapping_process(keyrecord_t record) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
             ac_dprintf("\n\n");
+            if (waiting_buffer[waiting_buffer_tail].event.pressed) {
+                waiting_buffer_presses--;
+            }
         } else {
             break;
         }
@@ -309,6 +332,9 @@ bool process_tapping(keyrecord_t *keyp) {
                             .event.time    = event.time,
                             .event.pressed = false,
                             .event.type    = tapping_key.event.type,
+#    ifdef KEYEVENT_HIRES_TIME
+                            .event.time_hires = event.time_hires,
+#    endif
 #    ifdef COMBO_ENABLE
                             .keycode = tapping_key.keycode,
 #    endif
@@ -360,6 +386,9 @@ bool process_tapping(keyrecord_t *keyp) {
                             .event.time    = event.time,
                             .event.pressed = false,
                             .event.type    = tapping_key.event.type,
+#    ifdef KEYEVENT_HIRES_TIME
+                            .event.time_hires = event.time_hires,
+#    endif
 #    ifdef COMBO_ENABLE
                             .keycode = tapping_key.keycode,
 #    endif
@@ -448,6 +477,9 @@ bool waiting_buffer_enq(keyrecord_t record) {
 
     waiting_buffer[waiting_buffer_head] = record;
     waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+    if (record.event.pressed) {
+        waiting_buffer_presses++;
+    }
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
@@ -459,8 +491,9 @@ bool waiting_buffer_enq(keyrecord_t record) {
  * FIXME: Needs docs
  */
 void waiting_buffer_clear(void) {
-    waiting_buffer_head = 0;
-    waiting_buffer_tail = 0;
+    waiting_buffer_head    = 0;
+    waiting_buffer_tail    = 0;
+    waiting_buffer_presses = 0;
 }
 
 /** \brief Waiting buffer typed
@@ -468,6 +501,12 @@ void waiting_buffer_clear(void) {
  * FIXME: Needs docs
  */
 bool waiting_buffer_typed(keyevent_t event) {
+    // Only an event of the opposite state can match, skip the scan when there is none
+    uint8_t length = (waiting_buffer_head + WAITING_BUFFER_SIZE - waiting_buffer_tail) % WAITING_BUFFER_SIZE;
+    if ((event.pressed ? length - waiting_buffer_presses : waiting_buffer_presses) == 0) {
+        return false;
+    }
+
     for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
         if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
             return true;
@@ -481,10 +520,7 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (waiting_buffer[i].event.pressed) return true;
-    }
-    return false;
+    return waiting_buffer_presses > 0;
 }
 
 /** \brief Scan buffer for tapping
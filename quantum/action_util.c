@@ -282,18 +282,183 @@ static uint8_t get_mods_for_report(void) {
     return mods;
 }
 
+#ifdef KEYBOARD_REPORT_COALESCE
+/* Report coalescing
+ *
+ * Instead of sending each keyboard report as soon as it is built, the latest one is kept pending and sent by
+ * keyboard_report_coalesce_task() at the end of the scan, or once the coalescing window has elapsed. A pending
+ * report is only replaced by the next one when the host cannot tell the difference. If the next report would undo
+ * a change which has not been sent yet (a key or modifier toggled twice), or change the modifiers applied to a key
+ * press which has not been sent yet, the pending report is flushed first.
+ */
+#    ifndef KEYBOARD_REPORT_COALESCE_WINDOW
+#        define KEYBOARD_REPORT_COALESCE_WINDOW 0
+#    endif
+
+static uint32_t          coalesce_window_start = 0;
+static bool              coalesce_6kro_pending = false;
+static report_keyboard_t coalesce_6kro_sent;
+static report_keyboard_t coalesce_6kro_next;
+#    ifdef NKRO_ENABLE
+static bool          coalesce_nkro_pending = false;
+static report_nkro_t coalesce_nkro_sent;
+static report_nkro_t coalesce_nkro_next;
+#    endif
+
+static void coalesce_start_window(void) {
+    bool pending = coalesce_6kro_pending;
+#    ifdef NKRO_ENABLE
+    pending |= coalesce_nkro_pending;
+#    endif
+    if (!pending) {
+        coalesce_window_start = timer_read_hires();
+    }
+}
+
+static void flush_6kro_report(void) {
+    memcpy(&coalesce_6kro_sent, &coalesce_6kro_next, sizeof(report_keyboard_t));
+    coalesce_6kro_pending = false;
+    host_keyboard_send(&coalesce_6kro_sent);
+}
+
+// V-USB sends 6KRO reports immediately, see send_6kro_report()
+#    ifndef PROTOCOL_VUSB
+static bool report_6kro_has_key(const report_keyboard_t *report, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** \brief Checks whether replacing the pending report with `next` would hide a transition from the host
+ *
+ * \param sent The last report sent to the host
+ * \param pending The report waiting to be sent
+ * \param next The report replacing it
+ */
+static bool coalesce_6kro_conflicts(const report_keyboard_t *sent, const report_keyboard_t *pending, const report_keyboard_t *next) {
+    if ((sent->mods ^ pending->mods) & (pending->mods ^ next->mods)) {
+        return true;
+    }
+
+    bool key_pressed = false;
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t key = pending->keys[i];
+        if (key != KC_NO && !report_6kro_has_key(sent, key)) {
+            // Pressed, then released before the press was sent
+            if (!report_6kro_has_key(next, key)) {
+                return true;
+            }
+            key_pressed = true;
+        }
+        key = sent->keys[i];
+        if (key != KC_NO && !report_6kro_has_key(pending, key) && report_6kro_has_key(next, key)) {
+            // Released, then pressed again before the release was sent
+            return true;
+        }
+    }
+
+    return key_pressed && pending->mods != next->mods;
+}
+
+static void coalesce_6kro_report(const report_keyboard_t *report) {
+    if (coalesce_6kro_pending && coalesce_6kro_conflicts(&coalesce_6kro_sent, &coalesce_6kro_next, report)) {
+        flush_6kro_report();
+    }
+    coalesce_start_window();
+    memcpy(&coalesce_6kro_next, report, sizeof(report_keyboard_t));
+    coalesce_6kro_pending = true;
+}
+#    endif
+
+#    ifdef NKRO_ENABLE
+static bool coalesce_nkro_conflicts(const report_nkro_t *sent, const report_nkro_t *pending, const report_nkro_t *next) {
+    if ((sent->mods ^ pending->mods) & (pending->mods ^ next->mods)) {
+        return true;
+    }
+
+    uint8_t pressed = 0;
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        if ((sent->bits[i] ^ pending->bits[i]) & (pending->bits[i] ^ next->bits[i])) {
+            return true;
+        }
+        pressed |= pending->bits[i] & ~sent->bits[i];
+    }
+
+    return pressed && pending->mods != next->mods;
+}
+
+static void flush_nkro_report(void) {
+    memcpy(&coalesce_nkro_sent, &coalesce_nkro_next, sizeof(report_nkro_t));
+    coalesce_nkro_pending = false;
+    host_nkro_send(&coalesce_nkro_sent);
+}
+
+static void coalesce_nkro_report(const report_nkro_t *report) {
+    if (coalesce_nkro_pending && coalesce_nkro_conflicts(&coalesce_nkro_sent, &coalesce_nkro_next, report)) {
+        flush_nkro_report();
+    }
+    coalesce_start_window();
+    memcpy(&coalesce_nkro_next, report, sizeof(report_nkro_t));
+    coalesce_nkro_pending = true;
+}
+#    endif
+
+/** \brief Sends the pending keyboard report once the coalescing window has elapsed
+ *
+ * Called at the end of every keyboard_task().
+ */
+void keyboard_report_coalesce_task(void) {
+#    if KEYBOARD_REPORT_COALESCE_WINDOW > 0
+    if (timer_hires_to_us(timer_read_hires() - coalesce_window_start) < KEYBOARD_REPORT_COALESCE_WINDOW) {
+        return;
+    }
+#    endif
+    flush_keyboard_report();
+}
+#endif
+
+/** \brief Sends the pending keyboard report immediately
+ *
+ * Does nothing unless KEYBOARD_REPORT_COALESCE is defined, as reports are otherwise never held back.
+ */
+void flush_keyboard_report(void) {
+#ifdef KEYBOARD_REPORT_COALESCE
+    if (coalesce_6kro_pending) {
+        flush_6kro_report();
+    }
+#    ifdef NKRO_ENABLE
+    if (coalesce_nkro_pending) {
+        flush_nkro_report();
+    }
+#    endif
+#endif
+}
+
 void send_6kro_report(void) {
     keyboard_report->mods = get_mods_for_report();
 
 #ifdef PROTOCOL_VUSB
     host_keyboard_send(keyboard_report);
+    clear_key_report_dirty();
 #else
     static report_keyboard_t last_report;
 
-    /* Only send the report if there are changes to propagate to the host. */
+    /* Only send the report if there are changes to propagate to the host. Keys are tracked by the dirty flag, so
+     * the full comparison is only needed when they were touched, to drop changes which cancelled each other out. */
+    if (!is_key_report_dirty() && keyboard_report->mods == last_report.mods) {
+        return;
+    }
+    clear_key_report_dirty();
     if (memcmp(keyboard_report, &last_report, sizeof(report_keyboard_t)) != 0) {
         memcpy(&last_report, keyboard_report, sizeof(report_keyboard_t));
+#    ifdef KEYBOARD_REPORT_COALESCE
+        coalesce_6kro_report(keyboard_report);
+#    else
         host_keyboard_send(keyboard_report);
+#    endif
     }
 #endif
 }
@@ -305,9 +470,17 @@ void send_nkro_report(void) {
     static report_nkro_t last_report;
 
     /* Only send the report if there are changes to propagate to the host. */
+    if (!is_key_report_dirty() && nkro_report->mods == last_report.mods) {
+        return;
+    }
+    clear_key_report_dirty();
     if (memcmp(nkro_report, &last_report, sizeof(report_nkro_t)) != 0) {
         memcpy(&last_report, nkro_report, sizeof(report_nkro_t));
+#    ifdef KEYBOARD_REPORT_COALESCE
+        coalesce_nkro_report(nkro_report);
+#    else
         host_nkro_send(nkro_report);
+#    endif
     }
 }
 #endif
@@ -318,6 +491,15 @@ void send_nkro_report(void) {
  */
 void send_keyboard_report(void) {
 #ifdef NKRO_ENABLE
+    // Each report type compares against the last one of its own type, which may be stale after switching
+    static bool last_nkro = false;
+    if ((keyboard_protocol && keymap_config.nkro) != last_nkro) {
+        last_nkro = !last_nkro;
+        set_key_report_dirty();
+        // Keep reports of the previous type ahead of the first one of the new type
+        flush_keyboard_report();
+    }
+
     if (keyboard_protocol && keymap_config.nkro) {
         send_nkro_report();
     } else {
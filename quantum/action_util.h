@@ -31,6 +31,10 @@ extern report_nkro_t *nkro_report;
 #endif
 
 void send_keyboard_report(void);
+void flush_keyboard_report(void);
+#ifdef KEYBOARD_REPORT_COALESCE
+void keyboard_report_coalesce_task(void);
+#endif
 
 /* key */
 inline void add_key(uint8_t key) {
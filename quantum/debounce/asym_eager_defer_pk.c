@@ -25,6 +25,7 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 #include "debounce.h"
 #include "timer.h"
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef PROTOCOL_CHIBIOS
 #    if CH_CFG_USE_MEMCORE == FALSE
@@ -56,6 +57,9 @@ static bool                counters_need_update;
 static bool                matrix_need_update;
 static bool                cooked_changed;
 
+// Keys with a running counter, so that only those are visited while counting down
+static matrix_row_t counters_active[MATRIX_ROWS];
+
 #    define DEBOUNCE_ELAPSED 0
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
@@ -70,6 +74,7 @@ void debounce_init(uint8_t num_rows) {
             debounce_counters[i++].time = DEBOUNCE_ELAPSED;
         }
     }
+    memset(counters_active, 0, sizeof(counters_active));
 }
 
 void debounce_free(void) {
@@ -108,67 +113,77 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 }
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
-
     counters_need_update = false;
     matrix_need_update   = false;
 
     for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        matrix_row_t        active           = counters_active[row];
+        debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS];
+
+        for (uint8_t col = 0; active; col++, active >>= 1) {
+            if (!(active & 1)) {
+                continue;
+            }
+
             matrix_row_t col_mask = (ROW_SHIFTER << col);
 
-            if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
-                if (debounce_pointer->time <= elapsed_time) {
-                    debounce_pointer->time = DEBOUNCE_ELAPSED;
+            if (debounce_pointer[col].time <= elapsed_time) {
+                debounce_pointer[col].time = DEBOUNCE_ELAPSED;
+                counters_active[row] &= ~col_mask;
 
-                    if (debounce_pointer->pressed) {
-                        // key-down: eager
-                        matrix_need_update = true;
-                    } else {
-                        // key-up: defer
-                        matrix_row_t cooked_next = (cooked[row] & ~col_mask) | (raw[row] & col_mask);
-                        cooked_changed |= cooked_next ^ cooked[row];
-                        cooked[row] = cooked_next;
-                    }
+                if (debounce_pointer[col].pressed) {
+                    // key-down: eager
+                    matrix_need_update = true;
                 } else {
-                    debounce_pointer->time -= elapsed_time;
-                    counters_need_update = true;
+                    // key-up: defer
+                    matrix_row_t cooked_next = (cooked[row] & ~col_mask) | (raw[row] & col_mask);
+                    cooked_changed |= cooked_next ^ cooked[row];
+                    cooked[row] = cooked_next;
                 }
+            } else {
+                debounce_pointer[col].time -= elapsed_time;
+                counters_need_update = true;
             }
-            debounce_pointer++;
         }
     }
 }
 
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
-
     matrix_need_update = false;
 
     for (uint8_t row = 0; row < num_rows; row++) {
-        matrix_row_t delta = raw[row] ^ cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        matrix_row_t        delta            = raw[row] ^ cooked[row];
+        debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS];
+
+        // Only keys which differ or have a running counter can change state
+        matrix_row_t bits = delta | counters_active[row];
+        for (uint8_t col = 0; bits; col++, bits >>= 1) {
+            if (!(bits & 1)) {
+                continue;
+            }
+
             matrix_row_t col_mask = (ROW_SHIFTER << col);
 
             if (delta & col_mask) {
-                if (debounce_pointer->time == DEBOUNCE_ELAPSED) {
-                    debounce_pointer->pressed = (raw[row] & col_mask);
-                    debounce_pointer->time    = DEBOUNCE;
-                    counters_need_update      = true;
+                if (debounce_pointer[col].time == DEBOUNCE_ELAPSED) {
+                    debounce_pointer[col].pressed = (raw[row] & col_mask);
+                    debounce_pointer[col].time    = DEBOUNCE;
+                    counters_active[row] |= col_mask;
+                    counters_need_update = true;
 
-                    if (debounce_pointer->pressed) {
+                    if (debounce_pointer[col].pressed) {
                         // key-down: eager
                         cooked[row] ^= col_mask;
                         cooked_changed = true;
                     }
                 }
-            } else if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
-                if (!debounce_pointer->pressed) {
+            } else if (debounce_pointer[col].time != DEBOUNCE_ELAPSED) {
+                if (!debounce_pointer[col].pressed) {
                     // key-up: defer
-                    debounce_pointer->time = DEBOUNCE_ELAPSED;
+                    debounce_pointer[col].time = DEBOUNCE_ELAPSED;
+                    counters_active[row] &= ~col_mask;
                 }
             }
-            debounce_pointer++;
         }
     }
 }
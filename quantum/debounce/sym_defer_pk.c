@@ -22,6 +22,7 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 #include "debounce.h"
 #include "timer.h"
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef PROTOCOL_CHIBIOS
 #    if CH_CFG_USE_MEMCORE == FALSE
@@ -49,6 +50,9 @@ static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                cooked_changed;
 
+// Keys with a running counter, so that only those are visited while counting down
+static matrix_row_t counters_active[MATRIX_ROWS];
+
 #    define DEBOUNCE_ELAPSED 0
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
@@ -63,6 +67,7 @@ void debounce_init(uint8_t num_rows) {
             debounce_counters[i++] = DEBOUNCE_ELAPSED;
         }
     }
+    memset(counters_active, 0, sizeof(counters_active));
 }
 
 void debounce_free(void) {
@@ -101,41 +106,48 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 }
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
-    counters_need_update                 = false;
-    debounce_counter_t *debounce_pointer = debounce_counters;
+    counters_need_update = false;
     for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            if (*debounce_pointer != DEBOUNCE_ELAPSED) {
-                if (*debounce_pointer <= elapsed_time) {
-                    *debounce_pointer        = DEBOUNCE_ELAPSED;
+        matrix_row_t        active           = counters_active[row];
+        debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS];
+        for (uint8_t col = 0; active; col++, active >>= 1) {
+            if (active & 1) {
+                if (debounce_pointer[col] <= elapsed_time) {
+                    debounce_pointer[col] = DEBOUNCE_ELAPSED;
+                    counters_active[row] &= ~(ROW_SHIFTER << col);
                     matrix_row_t cooked_next = (cooked[row] & ~(ROW_SHIFTER << col)) | (raw[row] & (ROW_SHIFTER << col));
                     cooked_changed |= cooked[row] ^ cooked_next;
                     cooked[row] = cooked_next;
                 } else {
-                    *debounce_pointer -= elapsed_time;
+                    debounce_pointer[col] -= elapsed_time;
                     counters_need_update = true;
                 }
             }
-            debounce_pointer++;
         }
     }
 }
 
 static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
     for (uint8_t row = 0; row < num_rows; row++) {
-        matrix_row_t delta = raw[row] ^ cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            if (delta & (ROW_SHIFTER << col)) {
-                if (*debounce_pointer == DEBOUNCE_ELAPSED) {
-                    *debounce_pointer    = DEBOUNCE;
-                    counters_need_update = true;
+        matrix_row_t        delta            = raw[row] ^ cooked[row];
+        matrix_row_t        active           = counters_active[row];
+        debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS];
+
+        // Keys which went back to their cooked state stop debouncing, new changes start their counter
+        matrix_row_t bits = delta | active;
+        for (uint8_t col = 0; bits; col++, bits >>= 1) {
+            if (bits & 1) {
+                if (delta & (ROW_SHIFTER << col)) {
+                    if (debounce_pointer[col] == DEBOUNCE_ELAPSED) {
+                        debounce_pointer[col] = DEBOUNCE;
+                        counters_need_update  = true;
+                    }
+                } else {
+                    debounce_pointer[col] = DEBOUNCE_ELAPSED;
                 }
-            } else {
-                *debounce_pointer = DEBOUNCE_ELAPSED;
             }
-            debounce_pointer++;
         }
+        counters_active[row] = delta;
     }
 }
 
@@ -0,0 +1,174 @@
+/*
+Copyright 2023 QMK
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Symmetric per-key algorithm using vertical (bit-sliced) counters.
+Behaves like sym_defer_pk: when no state changes have occured on a key for DEBOUNCE milliseconds, we push its state.
+
+Instead of one 8-bit counter per key, each row stores one matrix_row_t per counter bit, so bit N of every
+counter of a row lives in the same word. All columns of a row are then updated with a handful of bitwise
+operations, and the cost of a scan does not depend on how many keys are bouncing.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+#include <string.h>
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE < 2
+#    define DEBOUNCE_BITS 1
+#elif DEBOUNCE < 4
+#    define DEBOUNCE_BITS 2
+#elif DEBOUNCE < 8
+#    define DEBOUNCE_BITS 3
+#elif DEBOUNCE < 16
+#    define DEBOUNCE_BITS 4
+#elif DEBOUNCE < 32
+#    define DEBOUNCE_BITS 5
+#elif DEBOUNCE < 64
+#    define DEBOUNCE_BITS 6
+#elif DEBOUNCE < 128
+#    define DEBOUNCE_BITS 7
+#else
+#    define DEBOUNCE_BITS 8
+#endif
+
+#if DEBOUNCE > 0
+// counter_bits[row][bit] holds bit `bit` of the remaining debounce time of every key in `row`
+static matrix_row_t counter_bits[MATRIX_ROWS][DEBOUNCE_BITS];
+// Keys with a running counter, so that idle rows can be skipped without looking at every bit plane
+static matrix_row_t counters_active[MATRIX_ROWS];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    memset(counter_bits, 0, sizeof(counter_bits));
+    memset(counters_active, 0, sizeof(counters_active));
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t active = counters_active[row];
+        if (!active) {
+            continue;
+        }
+
+        // Subtract elapsed_time from every counter of the row at once, as a ripple-borrow subtraction over the bit planes
+        matrix_row_t *bits      = counter_bits[row];
+        matrix_row_t  borrow    = 0;
+        matrix_row_t  remaining = 0;
+        for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+            matrix_row_t a = bits[bit];
+            matrix_row_t b = (elapsed_time & (1 << bit)) ? ~(matrix_row_t)0 : 0;
+            bits[bit]      = a ^ b ^ borrow;
+            borrow         = (~a & (b | borrow)) | (a & b & borrow);
+            remaining |= bits[bit];
+        }
+        // Any elapsed time that does not fit in the counter width is an underflow too
+        if (elapsed_time >> DEBOUNCE_BITS) {
+            borrow = ~(matrix_row_t)0;
+        }
+
+        // Counters which reached zero or underflowed have expired
+        matrix_row_t expired = active & (borrow | ~remaining);
+        active &= ~expired;
+        for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+            bits[bit] &= active;
+        }
+        counters_active[row] = active;
+
+        if (expired) {
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+        if (active) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t  delta  = raw[row] ^ cooked[row];
+        matrix_row_t  start  = delta & ~counters_active[row];
+        matrix_row_t *bits   = counter_bits[row];
+        matrix_row_t  active = counters_active[row] & delta;
+
+        // Keys that returned to their cooked state stop debouncing, new changes load DEBOUNCE into their counter
+        for (uint8_t bit = 0; bit < DEBOUNCE_BITS; bit++) {
+            bits[bit] &= active;
+            if (DEBOUNCE & (1 << bit)) {
+                bits[bit] |= start;
+            }
+        }
+
+        counters_active[row] = active | start;
+        if (start) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
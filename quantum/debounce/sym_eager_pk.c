@@ -22,6 +22,7 @@ No further inputs are accepted until DEBOUNCE milliseconds have occurred.
 #include "debounce.h"
 #include "timer.h"
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef PROTOCOL_CHIBIOS
 #    if CH_CFG_USE_MEMCORE == FALSE
@@ -50,6 +51,9 @@ static bool                counters_need_update;
 static bool                matrix_need_update;
 static bool                cooked_changed;
 
+// Keys with a running counter, so that only those are visited while counting down
+static matrix_row_t counters_active[MATRIX_ROWS];
+
 #    define DEBOUNCE_ELAPSED 0
 
 static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time);
@@ -64,6 +68,7 @@ void debounce_init(uint8_t num_rows) {
             debounce_counters[i++] = DEBOUNCE_ELAPSED;
         }
     }
+    memset(counters_active, 0, sizeof(counters_active));
 }
 
 void debounce_free(void) {
@@ -103,45 +108,46 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 
 // If the current time is > debounce counter, set the counter to enable input.
 static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time) {
-    counters_need_update                 = false;
-    matrix_need_update                   = false;
-    debounce_counter_t *debounce_pointer = debounce_counters;
+    counters_need_update = false;
+    matrix_need_update   = false;
     for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            if (*debounce_pointer != DEBOUNCE_ELAPSED) {
-                if (*debounce_pointer <= elapsed_time) {
-                    *debounce_pointer  = DEBOUNCE_ELAPSED;
+        matrix_row_t        active           = counters_active[row];
+        debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS];
+        for (uint8_t col = 0; active; col++, active >>= 1) {
+            if (active & 1) {
+                if (debounce_pointer[col] <= elapsed_time) {
+                    debounce_pointer[col] = DEBOUNCE_ELAPSED;
+                    counters_active[row] &= ~(ROW_SHIFTER << col);
                     matrix_need_update = true;
                 } else {
-                    *debounce_pointer -= elapsed_time;
+                    debounce_pointer[col] -= elapsed_time;
                     counters_need_update = true;
                 }
             }
-            debounce_pointer++;
         }
     }
 }
 
 // upload from raw_matrix to final matrix;
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    matrix_need_update                   = false;
-    debounce_counter_t *debounce_pointer = debounce_counters;
+    matrix_need_update = false;
     for (uint8_t row = 0; row < num_rows; row++) {
-        matrix_row_t delta        = raw[row] ^ cooked[row];
-        matrix_row_t existing_row = cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            matrix_row_t col_mask = (ROW_SHIFTER << col);
-            if (delta & col_mask) {
-                if (*debounce_pointer == DEBOUNCE_ELAPSED) {
-                    *debounce_pointer    = DEBOUNCE;
-                    counters_need_update = true;
-                    existing_row ^= col_mask; // flip the bit.
-                    cooked_changed = true;
-                }
+        // Keys with a running counter do not accept input, so only idle keys which differ need to be visited
+        matrix_row_t        start            = (raw[row] ^ cooked[row]) & ~counters_active[row];
+        debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS];
+        if (!start) {
+            continue;
+        }
+        matrix_row_t bits = start;
+        for (uint8_t col = 0; bits; col++, bits >>= 1) {
+            if (bits & 1) {
+                debounce_pointer[col] = DEBOUNCE;
             }
-            debounce_pointer++;
         }
-        cooked[row] = existing_row;
+        counters_active[row] |= start;
+        counters_need_update = true;
+        cooked[row] ^= start; // flip the bits.
+        cooked_changed = true;
     }
 }
 
@@ -52,3 +52,19 @@ debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+
+debounce_sym_defer_vc_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_vc_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_vc.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_vc_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_vc_model_tests.cpp
+
+debounce_sym_defer_vc_large_DEFS := -DMATRIX_ROWS=16 -DMATRIX_COLS=24 -DDEBOUNCE=20
+debounce_sym_defer_vc_large_SRC := $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/debounce/sym_defer_vc.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_vc_model_tests.cpp
+
+debounce_sym_defer_pk_large_DEFS := -DMATRIX_ROWS=16 -DMATRIX_COLS=24 -DDEBOUNCE=20
+debounce_sym_defer_pk_large_SRC := $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_vc_model_tests.cpp
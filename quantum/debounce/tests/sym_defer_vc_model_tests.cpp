@@ -0,0 +1,145 @@
+/* Copyright 2023 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <random>
+
+extern "C" {
+#include "debounce.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/*
+ * Reference model with the same semantics as sym_defer_pk: one counter per key, set to DEBOUNCE when the raw
+ * state starts to differ from the cooked state, cleared when it returns, pushed once it has counted down.
+ */
+class PerKeyModel {
+   public:
+    bool debounce(const matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
+        bool     cooked_changed = false;
+        bool     updated_last   = false;
+        uint32_t now            = timer_read32();
+
+        if (need_update_) {
+            uint32_t elapsed = std::min<uint32_t>(now - last_time_, UINT8_MAX);
+            last_time_       = now;
+            updated_last     = true;
+            need_update_     = false;
+            for (int row = 0; row < MATRIX_ROWS; row++) {
+                for (int col = 0; col < MATRIX_COLS; col++) {
+                    auto &counter = counters_[row][col];
+                    if (counter == 0 || elapsed == 0) {
+                        need_update_ |= counter != 0;
+                        continue;
+                    }
+                    if (counter <= elapsed) {
+                        matrix_row_t mask = (matrix_row_t)1 << col;
+                        counter           = 0;
+                        cooked_changed |= (cooked[row] ^ raw[row]) & mask;
+                        cooked[row] = (cooked[row] & ~mask) | (raw[row] & mask);
+                    } else {
+                        counter -= elapsed;
+                        need_update_ = true;
+                    }
+                }
+            }
+        }
+
+        if (changed) {
+            if (!updated_last) {
+                last_time_ = now;
+            }
+            for (int row = 0; row < MATRIX_ROWS; row++) {
+                matrix_row_t delta = raw[row] ^ cooked[row];
+                for (int col = 0; col < MATRIX_COLS; col++) {
+                    auto &counter = counters_[row][col];
+                    if (delta & ((matrix_row_t)1 << col)) {
+                        if (counter == 0) {
+                            counter      = DEBOUNCE;
+                            need_update_ = true;
+                        }
+                    } else {
+                        counter = 0;
+                    }
+                }
+            }
+        }
+
+        return cooked_changed;
+    }
+
+   private:
+    uint32_t counters_[MATRIX_ROWS][MATRIX_COLS] = {};
+    uint32_t last_time_                          = 0;
+    bool     need_update_                        = false;
+};
+
+static void run_against_model(uint32_t seed, uint32_t max_step, int max_flips) {
+    std::mt19937                    rng(seed);
+    std::uniform_int_distribution<> step_dist(0, max_step);
+    std::uniform_int_distribution<> flip_dist(0, max_flips);
+    std::uniform_int_distribution<> row_dist(0, MATRIX_ROWS - 1);
+    std::uniform_int_distribution<> col_dist(0, MATRIX_COLS - 1);
+
+    PerKeyModel  model;
+    matrix_row_t raw[MATRIX_ROWS]          = {0};
+    matrix_row_t cooked[MATRIX_ROWS]       = {0};
+    matrix_row_t model_cooked[MATRIX_ROWS] = {0};
+
+    set_time(1234);
+    debounce_init(MATRIX_ROWS);
+
+    for (int i = 0; i < 20000; i++) {
+        int flips = flip_dist(rng);
+        for (int f = 0; f < flips; f++) {
+            raw[row_dist(rng)] ^= (matrix_row_t)1 << col_dist(rng);
+        }
+        bool changed = flips > 0;
+
+        bool result       = debounce(raw, cooked, MATRIX_ROWS, changed);
+        bool model_result = model.debounce(raw, model_cooked, changed);
+
+        ASSERT_EQ(result, model_result) << "iteration " << i;
+        for (int row = 0; row < MATRIX_ROWS; row++) {
+            ASSERT_EQ(cooked[row], model_cooked[row]) << "iteration " << i << " row " << row;
+        }
+
+        advance_time(step_dist(rng));
+    }
+
+    debounce_free();
+}
+
+TEST(DebounceModelTest, RegularScanFewKeys) {
+    run_against_model(1, 1, 1);
+}
+
+TEST(DebounceModelTest, IrregularScanFewKeys) {
+    run_against_model(2, DEBOUNCE + 3, 1);
+}
+
+TEST(DebounceModelTest, RegularScanManyKeys) {
+    run_against_model(3, 1, 8);
+}
+
+TEST(DebounceModelTest, IrregularScanManyKeys) {
+    run_against_model(4, DEBOUNCE + 3, 8);
+}
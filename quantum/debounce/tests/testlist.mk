@@ -5,4 +5,7 @@ TEST_LIST += \
 	debounce_sym_defer_pr \
 	debounce_sym_eager_pk \
 	debounce_sym_eager_pr \
-	debounce_asym_eager_defer_pk
+	debounce_asym_eager_defer_pk \
+	debounce_sym_defer_vc \
+	debounce_sym_defer_vc_large \
+	debounce_sym_defer_pk_large
@@ -156,22 +156,263 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     }
 }
 
+//------------------------------------
+// Queue API: heap-ordered executors, for core code with many concurrent executors.
+//
+
+static inline bool trigger_before(uint32_t a, uint32_t b) {
+    return ((int32_t)TIMER_DIFF_32(a, b)) < 0;
+}
+
+static inline uint32_t queue_trigger_time(deferred_exec_queue_t *queue, uint8_t heap_index) {
+    return queue->entries[queue->heap[heap_index]].trigger_time;
+}
+
+static void queue_swap(deferred_exec_queue_t *queue, uint8_t a, uint8_t b) {
+    uint8_t entry_a = queue->heap[a];
+    uint8_t entry_b = queue->heap[b];
+
+    queue->heap[a]                     = entry_b;
+    queue->heap[b]                     = entry_a;
+    queue->entries[entry_a].heap_index = b;
+    queue->entries[entry_b].heap_index = a;
+}
+
+static uint8_t queue_sift_up(deferred_exec_queue_t *queue, uint8_t heap_index) {
+    while (heap_index > 0) {
+        uint8_t parent = (heap_index - 1) / 2;
+        if (!trigger_before(queue_trigger_time(queue, heap_index), queue_trigger_time(queue, parent))) {
+            break;
+        }
+        queue_swap(queue, heap_index, parent);
+        heap_index = parent;
+    }
+    return heap_index;
+}
+
+static void queue_sift_down(deferred_exec_queue_t *queue, uint8_t heap_index) {
+    while (true) {
+        uint16_t left     = 2 * heap_index + 1;
+        uint16_t right    = left + 1;
+        uint8_t  earliest = heap_index;
+
+        if (left < queue->count && trigger_before(queue_trigger_time(queue, left), queue_trigger_time(queue, earliest))) {
+            earliest = left;
+        }
+        if (right < queue->count && trigger_before(queue_trigger_time(queue, right), queue_trigger_time(queue, earliest))) {
+            earliest = right;
+        }
+        if (earliest == heap_index) {
+            return;
+        }
+        queue_swap(queue, heap_index, earliest);
+        heap_index = earliest;
+    }
+}
+
+// Restores the heap order around an entry whose trigger time has changed
+static void queue_update(deferred_exec_queue_t *queue, uint8_t heap_index) {
+    if (queue_sift_up(queue, heap_index) == heap_index) {
+        queue_sift_down(queue, heap_index);
+    }
+}
+
+static void queue_init(deferred_exec_queue_t *queue) {
+    if (queue->initialised) {
+        return;
+    }
+    for (uint8_t i = 0; i < queue->size; ++i) {
+        queue->heap[i]               = i;
+        queue->entries[i].heap_index = i;
+        queue->entries[i].token      = INVALID_DEFERRED_TOKEN;
+    }
+    queue->count       = 0;
+    queue->initialised = true;
+}
+
+// Free entries hold INVALID_DEFERRED_TOKEN, so only queued executors are found
+static deferred_exec_queue_entry_t *queue_find(deferred_exec_queue_t *queue, deferred_token token) {
+    if (!queue || token == INVALID_DEFERRED_TOKEN || !queue->initialised) {
+        return NULL;
+    }
+    for (uint8_t i = 0; i < queue->size; ++i) {
+        if (queue->entries[i].token == token) {
+            return &queue->entries[i];
+        }
+    }
+    return NULL;
+}
+
+// Tokens are handed out in turn as allocate_token() does, so a cancelled token only comes back after all the others
+static deferred_token queue_allocate_token(deferred_exec_queue_t *queue) {
+    // The entry being claimed is free, so fewer than 255 tokens are in use and one is always available
+    do {
+        ++queue->last_token;
+    } while (queue->last_token == INVALID_DEFERRED_TOKEN || queue_find(queue, queue->last_token));
+    return queue->last_token;
+}
+
+// Takes an entry out of the heap, leaving it at the start of the free entries
+static void queue_unlink(deferred_exec_queue_t *queue, deferred_exec_queue_entry_t *entry) {
+    uint8_t heap_index = entry->heap_index;
+    uint8_t last       = --queue->count;
+
+    // Move the last entry into the hole
+    queue_swap(queue, heap_index, last);
+    if (heap_index < last) {
+        queue_update(queue, heap_index);
+    }
+}
+
+// Entries which fell behind during a task are parked at the end of the heap storage, until the task is done
+static void queue_park(deferred_exec_queue_t *queue, deferred_exec_queue_entry_t *entry) {
+    queue_unlink(queue, entry);
+    queue_swap(queue, queue->count, queue->size - queue->parked - 1);
+    ++queue->parked;
+}
+
+static void queue_unpark_all(deferred_exec_queue_t *queue) {
+    while (queue->parked > 0) {
+        queue_swap(queue, queue->size - queue->parked, queue->count);
+        --queue->parked;
+        queue_sift_up(queue, queue->count++);
+    }
+}
+
+static inline bool queue_is_parked(deferred_exec_queue_t *queue, deferred_exec_queue_entry_t *entry) {
+    return entry->heap_index >= queue->size - queue->parked;
+}
+
+static void queue_remove(deferred_exec_queue_t *queue, deferred_exec_queue_entry_t *entry) {
+    if (queue_is_parked(queue, entry)) {
+        // Move it to the start of the parked entries, which then become free
+        queue_swap(queue, entry->heap_index, queue->size - queue->parked);
+        --queue->parked;
+    } else {
+        queue_unlink(queue, entry);
+    }
+
+    entry->token        = INVALID_DEFERRED_TOKEN;
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
+}
+
+deferred_token defer_exec_queue(deferred_exec_queue_t *queue, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+    // Ignore queueing if the queue isn't valid, it's a zero-time delay, or the callback is not valid
+    if (!queue || queue->size == 0 || delay_ms == 0 || !callback) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+
+    queue_init(queue);
+    if (queue->count + queue->parked == queue->size) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+
+    // Claim the first free entry
+    uint8_t                      heap_index = queue->count++;
+    uint8_t                      index      = queue->heap[heap_index];
+    deferred_exec_queue_entry_t *entry      = &queue->entries[index];
+
+    entry->token        = queue_allocate_token(queue);
+    entry->trigger_time = timer_read32() + delay_ms;
+    entry->callback     = callback;
+    entry->cb_arg       = cb_arg;
+    queue_sift_up(queue, heap_index);
+    return entry->token;
+}
+
+bool extend_deferred_exec_queue(deferred_exec_queue_t *queue, deferred_token token, uint32_t delay_ms) {
+    deferred_exec_queue_entry_t *entry = queue_find(queue, token);
+    if (!entry || delay_ms == 0) {
+        return false;
+    }
+
+    entry->trigger_time = timer_read32() + delay_ms;
+    if (!queue_is_parked(queue, entry)) {
+        queue_update(queue, entry->heap_index);
+    }
+    return true;
+}
+
+bool cancel_deferred_exec_queue(deferred_exec_queue_t *queue, deferred_token token) {
+    deferred_exec_queue_entry_t *entry = queue_find(queue, token);
+    if (!entry) {
+        return false;
+    }
+
+    queue_remove(queue, entry);
+    return true;
+}
+
+bool deferred_exec_queue_next_deadline(deferred_exec_queue_t *queue, uint32_t *deadline) {
+    if (!queue || !queue->initialised || queue->count == 0) {
+        return false;
+    }
+
+    *deadline = queue_trigger_time(queue, 0);
+    return true;
+}
+
+void deferred_exec_queue_task(deferred_exec_queue_t *queue) {
+    uint32_t now = timer_read32();
+
+    // Throttle only once per millisecond, and skip entirely while nothing is queued
+    if (queue->count == 0 || ((int32_t)TIMER_DIFF_32(now, queue->last_execution_time)) <= 0) {
+        return;
+    }
+    queue->last_execution_time = now;
+
+    while (queue->count > 0) {
+        deferred_exec_queue_entry_t *entry      = &queue->entries[queue->heap[0]];
+        deferred_token               curr_token = entry->token;
+
+        if (trigger_before(now, entry->trigger_time)) {
+            break;
+        }
+
+        // Invoke the callback and work out if we should be requeued
+        uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+        // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
+        if (entry->token != curr_token) {
+            continue;
+        }
+
+        if (delay_ms > 0) {
+            // As with the advanced API, the next invocation is with respect to the previous trigger
+            entry->trigger_time += delay_ms;
+            if (trigger_before(now, entry->trigger_time)) {
+                queue_sift_down(queue, entry->heap_index);
+            } else {
+                // Still behind, leave it for the next invocation as the advanced API does
+                queue_park(queue, entry);
+            }
+        } else {
+            queue_remove(queue, entry);
+        }
+    }
+    queue_unpark_all(queue);
+}
+
 //------------------------------------
 // Basic API: used by user-mode code, guaranteed to not collide with core deferred execution
 //
 
-static uint32_t            last_deferred_exec_check                = 0;
-static deferred_executor_t basic_executors[MAX_DEFERRED_EXECUTORS] = {0};
+DEFERRED_EXEC_QUEUE(basic_executors, MAX_DEFERRED_EXECUTORS);
 
 deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
-    return defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    return defer_exec_queue(&basic_executors, delay_ms, callback, cb_arg);
 }
 bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
-    return extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms);
+    return extend_deferred_exec_queue(&basic_executors, token, delay_ms);
 }
 bool cancel_deferred_exec(deferred_token token) {
-    return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
+    return cancel_deferred_exec_queue(&basic_executors, token);
+}
+bool deferred_exec_next_deadline(uint32_t *deadline) {
+    return deferred_exec_queue_next_deadline(&basic_executors, deadline);
 }
 void deferred_exec_task(void) {
-    deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
+    deferred_exec_queue_task(&basic_executors);
 }
@@ -65,6 +65,14 @@ bool cancel_deferred_exec(deferred_token token);
  */
 void deferred_exec_task(void);
 
+/**
+ * Gets the time at which the earliest pending deferred execution is due, so that the main loop can tell how long it may idle.
+ *
+ * @param deadline[out] the trigger time of the earliest deferred execution -- equivalent time-space as timer_read32()
+ * @return true if a deferred execution is pending, otherwise false
+ */
+bool deferred_exec_next_deadline(uint32_t *deadline);
+
 //------------------------------------
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //------------------------------------
@@ -119,3 +127,93 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  * @param last_execution_time[in,out] the last execution time -- this will be checked first to determine if execution is needed, and updated if execution occurred
  */
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time);
+
+//------------------------------------
+// Queue API: heap-ordered alternative to the advanced API, for core code with many concurrent executors.
+//------------------------------------
+
+/**
+ * @struct Entry of a deferred execution queue.
+ * @brief Code outside deferred_exec.c should not worry about internals of this struct.
+ */
+typedef struct deferred_exec_queue_entry_t {
+    deferred_token         token;
+    uint8_t                heap_index; // position of this entry in the heap storage of its queue
+    uint32_t               trigger_time;
+    deferred_exec_callback callback;
+    void *                 cb_arg;
+} deferred_exec_queue_entry_t;
+
+/**
+ * @struct Deferred executors ordered by trigger time.
+ * @brief Running an executor costs O(log n), and an idle task only looks at the earliest executor, rather than scanning the
+ *        whole table as the advanced API does. Scheduling, extension and cancellation look tokens up among the entries. Code
+ *        outside deferred_exec.c should not worry about internals of this struct, and should declare queues with
+ *        DEFERRED_EXEC_QUEUE().
+ */
+typedef struct deferred_exec_queue_t {
+    deferred_exec_queue_entry_t *entries;
+    uint8_t *                    heap; // entry indices, the first `count` form a min-heap on trigger time, the last `parked` wait for the end of a task and the rest are free
+    uint8_t                      size;
+    uint8_t                      count;
+    uint8_t                      parked;
+    deferred_token               last_token;
+    bool                         initialised;
+    uint32_t                     last_execution_time;
+} deferred_exec_queue_t;
+
+/**
+ * @def Declares a static deferred execution queue `name`, holding up to `queue_size` executors.
+ */
+#define DEFERRED_EXEC_QUEUE(name, queue_size)                                                                             \
+    _Static_assert((queue_size) > 0 && (queue_size) <= UINT8_MAX, "deferred execution queues hold 1 to 255 executors"); \
+    static deferred_exec_queue_entry_t name##_entries[(queue_size)];                                                      \
+    static uint8_t                     name##_heap[(queue_size)];                                                         \
+    static deferred_exec_queue_t       name = {.entries = name##_entries, .heap = name##_heap, .size = (queue_size)}
+
+/**
+ * Configures the supplied deferred executor to be executed after the required number of milliseconds.
+ *
+ * @param queue[in] the queue used for storage
+ * @param delay_ms[in] the number of milliseconds before executing the callback
+ * @param callback[in] the executor to invoke
+ * @param cb_arg[in] the argument to pass to the executor, may be NULL if unused by the executor
+ * @return a token usable for extension/cancellation, or INVALID_DEFERRED_TOKEN if an error occurred
+ */
+deferred_token defer_exec_queue(deferred_exec_queue_t *queue, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg);
+
+/**
+ * Allows for extending the timeframe before an existing deferred execution is invoked.
+ *
+ * @param queue[in] the queue used for storage
+ * @param token[in] the returned value from defer_exec_queue for the deferred execution you wish to extend
+ * @param delay_ms[in] the number of milliseconds before executing the callback
+ * @return true if the token was extended successfully, otherwise false
+ */
+bool extend_deferred_exec_queue(deferred_exec_queue_t *queue, deferred_token token, uint32_t delay_ms);
+
+/**
+ * Allows for cancellation of an existing deferred execution.
+ *
+ * @param queue[in] the queue used for storage
+ * @param token[in] the returned value from defer_exec_queue for the deferred execution you wish to cancel
+ * @return true if the token was cancelled successfully, otherwise false
+ */
+bool cancel_deferred_exec_queue(deferred_exec_queue_t *queue, deferred_token token);
+
+/**
+ * Gets the time at which the earliest executor of the queue is due.
+ *
+ * @param queue[in] the queue used for storage
+ * @param deadline[out] the trigger time of the earliest executor -- equivalent time-space as timer_read32()
+ * @return true if an executor is pending, otherwise false
+ */
+bool deferred_exec_queue_next_deadline(deferred_exec_queue_t *queue, uint32_t *deadline);
+
+/**
+ * Executes the due executors of the queue, at most once per millisecond. Should not be invoked by keyboard/user code.
+ * Executors which fall behind and are re-queued into the past run again on the next invocation, as with the advanced API.
+ *
+ * @param queue[in] the queue used for storage
+ */
+void deferred_exec_queue_task(deferred_exec_queue_t *queue);
@@ -22,6 +22,19 @@
 #include "send_string.h"
 #include "keycodes.h"
 
+#ifdef KEYMAP_ACTION_CACHE
+#    include "keymap_common.h"
+#endif
+
+#ifdef LAYER_OPACITY_CACHE
+#    include "action_layer.h"
+#endif
+
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+#    include <string.h>
+#    include "timer.h"
+#endif
+
 #ifdef VIA_ENABLE
 #    include "via.h"
 #    define DYNAMIC_KEYMAP_EEPROM_START (VIA_EEPROM_CONFIG_END)
@@ -101,6 +114,74 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+// Layers from 0 up to this count are kept in RAM, higher ones are still read from EEPROM
+#    ifndef DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS
+#        define DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS DYNAMIC_KEYMAP_LAYER_COUNT
+#    endif
+#    if DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS > DYNAMIC_KEYMAP_LAYER_COUNT
+#        error DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS cannot exceed DYNAMIC_KEYMAP_LAYER_COUNT
+#    endif
+// Time in milliseconds without further changes after which modified keycodes are written back to EEPROM
+#    ifndef DYNAMIC_KEYMAP_FLUSH_DELAY
+#        define DYNAMIC_KEYMAP_FLUSH_DELAY 1000
+#    endif
+
+#    define DYNAMIC_KEYMAP_MIRROR_ROWS (DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS * MATRIX_ROWS)
+
+// Same layer/row/column order as in EEPROM, but in native byte order
+static uint16_t keymap_mirror[DYNAMIC_KEYMAP_MIRROR_ROWS][MATRIX_COLS];
+static bool     keymap_mirror_dirty_rows[DYNAMIC_KEYMAP_MIRROR_ROWS];
+#    ifdef ENCODER_MAP_ENABLE
+static uint16_t encoder_mirror[DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS][NUM_ENCODERS][2];
+static bool     encoder_mirror_dirty = false;
+#    endif
+static bool     mirror_loaded     = false;
+static bool     mirror_dirty      = false;
+static uint16_t mirror_last_write = 0;
+
+static void mirror_load(void) {
+    for (uint16_t row = 0; row < DYNAMIC_KEYMAP_MIRROR_ROWS; row++) {
+        // Keycodes are big endian in EEPROM, convert them in place after reading the whole row
+        uint8_t *bytes = (uint8_t *)keymap_mirror[row];
+        eeprom_read_block(bytes, ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (row * MATRIX_COLS * 2), MATRIX_COLS * 2);
+        for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+            keymap_mirror[row][column] = (bytes[column * 2] << 8) | bytes[column * 2 + 1];
+        }
+    }
+#    ifdef ENCODER_MAP_ENABLE
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS; layer++) {
+        uint8_t *bytes = (uint8_t *)encoder_mirror[layer];
+        eeprom_read_block(bytes, ((void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR) + (layer * NUM_ENCODERS * 2 * 2), NUM_ENCODERS * 2 * 2);
+        for (uint8_t i = 0; i < NUM_ENCODERS * 2; i++) {
+            encoder_mirror[layer][i / 2][i % 2] = (bytes[i * 2] << 8) | bytes[i * 2 + 1];
+        }
+    }
+#    endif // ENCODER_MAP_ENABLE
+    mirror_loaded = true;
+}
+
+static inline void mirror_ensure_loaded(void) {
+    if (!mirror_loaded) {
+        mirror_load();
+    }
+}
+
+static void mirror_mark_dirty(void) {
+    mirror_dirty      = true;
+    mirror_last_write = timer_read();
+}
+
+static void mirror_set_keycode(uint16_t row, uint8_t column, uint16_t keycode) {
+    mirror_ensure_loaded();
+    if (keymap_mirror[row][column] != keycode) {
+        keymap_mirror[row][column]    = keycode;
+        keymap_mirror_dirty_rows[row] = true;
+        mirror_mark_dirty();
+    }
+}
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -112,6 +193,12 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (layer < DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS) {
+        mirror_ensure_loaded();
+        return keymap_mirror[layer * MATRIX_ROWS + row][column];
+    }
+#endif
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
@@ -121,10 +208,23 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
-    void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
-    // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address, (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (layer < DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS) {
+        mirror_set_keycode(layer * MATRIX_ROWS + row, column, keycode);
+    } else
+#endif
+    {
+        void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        // Big endian, so we can read/write EEPROM directly from host if we want
+        eeprom_update_byte(address, (uint8_t)(keycode >> 8));
+        eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    }
+#ifdef KEYMAP_ACTION_CACHE
+    keymap_action_cache_invalidate_key(layer, row, column);
+#endif
+#ifdef LAYER_OPACITY_CACHE
+    layer_opacity_cache_invalidate_key(row, column);
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -134,6 +234,12 @@ void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id
 
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (layer < DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS) {
+        mirror_ensure_loaded();
+        return encoder_mirror[layer][encoder_id][clockwise ? 0 : 1];
+    }
+#    endif
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
@@ -143,6 +249,17 @@ uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool cloc
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (layer < DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS) {
+        mirror_ensure_loaded();
+        if (encoder_mirror[layer][encoder_id][clockwise ? 0 : 1] != keycode) {
+            encoder_mirror[layer][encoder_id][clockwise ? 0 : 1] = keycode;
+            encoder_mirror_dirty                                 = true;
+            mirror_mark_dirty();
+        }
+        return;
+    }
+#    endif
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
@@ -150,6 +267,38 @@ void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwis
 }
 #endif // ENCODER_MAP_ENABLE
 
+// Reads one byte of the keymap, as laid out in EEPROM
+static uint8_t keymap_buffer_read_byte(uint16_t offset) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (offset < sizeof(keymap_mirror)) {
+        mirror_ensure_loaded();
+        uint16_t keycode = keymap_mirror[offset / 2 / MATRIX_COLS][offset / 2 % MATRIX_COLS];
+        return (offset & 1) ? (keycode & 0xFF) : (keycode >> 8);
+    }
+#endif
+    return eeprom_read_byte((void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset));
+}
+
+// Writes one byte of the keymap, as laid out in EEPROM
+static void keymap_buffer_write_byte(uint16_t offset, uint8_t value) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (offset < sizeof(keymap_mirror)) {
+        mirror_ensure_loaded();
+        uint16_t row     = offset / 2 / MATRIX_COLS;
+        uint8_t  column  = offset / 2 % MATRIX_COLS;
+        uint16_t keycode = keymap_mirror[row][column];
+        if (offset & 1) {
+            keycode = (keycode & 0xFF00) | value;
+        } else {
+            keycode = (keycode & 0x00FF) | (value << 8);
+        }
+        mirror_set_keycode(row, column, keycode);
+        return;
+    }
+#endif
+    eeprom_update_byte((void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), value);
+}
+
 void dynamic_keymap_reset(void) {
     // Reset the keymaps in EEPROM to what is in flash.
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
@@ -165,36 +314,88 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    // The EEPROM may have been erased underneath the mirror, so write back every mirrored keycode
+    memset(keymap_mirror_dirty_rows, true, sizeof(keymap_mirror_dirty_rows));
+#    ifdef ENCODER_MAP_ENABLE
+    encoder_mirror_dirty = true;
+#    endif
+    mirror_mark_dirty();
+#endif
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *target                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
+            *target = keymap_buffer_read_byte(offset + i);
         } else {
             *target = 0x00;
         }
-        source++;
         target++;
     }
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *source                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
+            keymap_buffer_write_byte(offset + i, *source);
         }
         source++;
-        target++;
     }
+#ifdef KEYMAP_ACTION_CACHE
+    keymap_action_cache_invalidate();
+#endif
+#ifdef LAYER_OPACITY_CACHE
+    layer_opacity_cache_invalidate();
+#endif
 }
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+void dynamic_keymap_flush(void) {
+    if (!mirror_dirty) {
+        return;
+    }
+
+    uint8_t buffer[MATRIX_COLS * 2];
+    for (uint16_t row = 0; row < DYNAMIC_KEYMAP_MIRROR_ROWS; row++) {
+        if (!keymap_mirror_dirty_rows[row]) {
+            continue;
+        }
+        for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+            buffer[column * 2]     = keymap_mirror[row][column] >> 8;
+            buffer[column * 2 + 1] = keymap_mirror[row][column] & 0xFF;
+        }
+        eeprom_update_block(buffer, ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (row * MATRIX_COLS * 2), MATRIX_COLS * 2);
+        keymap_mirror_dirty_rows[row] = false;
+    }
+#    ifdef ENCODER_MAP_ENABLE
+    if (encoder_mirror_dirty) {
+        for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS; layer++) {
+            for (uint8_t encoder_id = 0; encoder_id < NUM_ENCODERS; encoder_id++) {
+                void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
+                for (uint8_t i = 0; i < 2; i++) {
+                    eeprom_update_byte(address + i * 2, (uint8_t)(encoder_mirror[layer][encoder_id][i] >> 8));
+                    eeprom_update_byte(address + i * 2 + 1, (uint8_t)(encoder_mirror[layer][encoder_id][i] & 0xFF));
+                }
+            }
+        }
+        encoder_mirror_dirty = false;
+    }
+#    endif // ENCODER_MAP_ENABLE
+    mirror_dirty = false;
+}
+
+void dynamic_keymap_task(void) {
+    if (mirror_dirty && timer_elapsed(mirror_last_write) >= DYNAMIC_KEYMAP_FLUSH_DELAY) {
+        dynamic_keymap_flush();
+    }
+}
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
     if (layer_num < DYNAMIC_KEYMAP_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
         return dynamic_keymap_get_keycode(layer_num, row, column);
@@ -220,7 +421,7 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -234,7 +435,7 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *source = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -285,7 +486,11 @@ void dynamic_keymap_macro_send(uint8_t id) {
     }
 
     // Send the macro string by making a temporary string.
+#ifdef SEND_STRING_BATCH
+    char data[16] = {0};
+#else
     char data[8] = {0};
+#endif
     // We already checked there was a null at the end of
     // the buffer, so this cannot go past the end
     while (1) {
@@ -335,6 +540,21 @@ void dynamic_keymap_macro_send(uint8_t id) {
                 }
             }
         }
+#ifdef SEND_STRING_BATCH
+        else {
+            // Gather the characters that follow, so that they are sent as one batch
+            uint8_t i = 1;
+            while (i < sizeof(data) - 1) {
+                data[i] = eeprom_read_byte(p);
+                if (data[i] == 0 || data[i] == SS_QMK_PREFIX) {
+                    break;
+                }
+                ++p;
+                ++i;
+            }
+            data[i] = 0;
+        }
+#endif
         send_string_with_delay(data, DYNAMIC_KEYMAP_MACRO_DELAY);
     }
 }
@@ -38,6 +38,13 @@ void dynamic_keymap_reset(void);
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+// With the RAM mirror, keycode writes only update RAM. These write the changes back to EEPROM, either right away, or
+// once no further changes have been made for DYNAMIC_KEYMAP_FLUSH_DELAY milliseconds.
+void dynamic_keymap_flush(void);
+void dynamic_keymap_task(void);
+#endif
+
 // This overrides the one in quantum/keymap_common.c
 // uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
 
@@ -0,0 +1,58 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "feature_timer.h"
+#include "timer.h"
+
+_Static_assert(FEATURE_TIMER_COUNT <= 8, "feature timers must fit in an 8-bit mask");
+
+static uint32_t deadlines[FEATURE_TIMER_COUNT];
+static uint32_t next_deadline = 0;
+static uint8_t  scheduled     = 0;
+
+void feature_timer_schedule(feature_timer_t timer, uint32_t delay_ms) {
+    uint32_t deadline = timer_read32() + delay_ms;
+    uint8_t  bit      = 1 << timer;
+
+    if ((scheduled & bit) && timer_expired32(deadline, deadlines[timer])) {
+        return;
+    }
+
+    deadlines[timer] = deadline;
+    if (!scheduled || !timer_expired32(deadline, next_deadline)) {
+        next_deadline = deadline;
+    }
+    scheduled |= bit;
+}
+
+bool feature_timer_due(uint32_t now) {
+    return scheduled && timer_expired32(now, next_deadline);
+}
+
+bool feature_timer_take(feature_timer_t timer, uint32_t now) {
+    uint8_t bit = 1 << timer;
+
+    if (!(scheduled & bit) || !timer_expired32(now, deadlines[timer])) {
+        return false;
+    }
+
+    scheduled &= ~bit;
+
+    // Find the earliest of the remaining wake-ups
+    bool first = true;
+    for (uint8_t i = 0; i < FEATURE_TIMER_COUNT; i++) {
+        if ((scheduled & (1 << i)) && (first || !timer_expired32(deadlines[i], next_deadline))) {
+            next_deadline = deadlines[i];
+            first         = false;
+        }
+    }
+    return true;
+}
+
+bool feature_timer_next_deadline(uint32_t *deadline) {
+    if (!scheduled) {
+        return false;
+    }
+    *deadline = next_deadline;
+    return true;
+}
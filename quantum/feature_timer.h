@@ -0,0 +1,41 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Wake-up times of the features whose tasks run from quantum_task().
+ *
+ * Rather than polling every task on every loop, a feature schedules a wake-up
+ * whenever it starts or changes a timeout, and its task is only called once
+ * that time is reached. A task called before its timeout has expired schedules
+ * itself again for the remaining time, so features may simply schedule a
+ * wake-up on the next loop and let their task work out the actual deadline.
+ *
+ * Tasks that are due at the same time run in the order of this enum. */
+typedef enum {
+    FEATURE_TIMER_KEY_OVERRIDE,
+    FEATURE_TIMER_TAP_DANCE,
+    FEATURE_TIMER_COMBO,
+    FEATURE_TIMER_LEADER,
+    FEATURE_TIMER_AUTO_SHIFT,
+    FEATURE_TIMER_CAPS_WORD,
+    FEATURE_TIMER_COUNT,
+} feature_timer_t;
+
+/* Wakes the task of a feature after delay_ms, or on the next loop for 0. A
+ * wake-up that is already scheduled earlier is kept. */
+void feature_timer_schedule(feature_timer_t timer, uint32_t delay_ms);
+
+/* Whether any wake-up is due at `now`, which costs a single comparison when
+ * none is. */
+bool feature_timer_due(uint32_t now);
+
+/* Returns true, and clears the wake-up, if the task of a feature is due. */
+bool feature_timer_take(feature_timer_t timer, uint32_t now);
+
+/* Gets the earliest scheduled wake-up, so that the main loop could sleep until
+ * then. Returns false if none is scheduled. */
+bool feature_timer_next_deadline(uint32_t *deadline);
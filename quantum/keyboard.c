@@ -20,6 +20,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keycode_config.h"
 #include "matrix.h"
 #include "keymap_introspection.h"
+#include "keymap_common.h"
 #include "magic.h"
 #include "host.h"
 #include "led.h"
@@ -33,6 +34,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "action_util.h"
+#include "feature_timer.h"
+#include "scan_profiler.h"
+#ifdef LATENCY_TRACER_ENABLE
+#    include "latency_tracer.h"
+#endif
 #ifdef AUDIO_ENABLE
 #    include "audio.h"
 #endif
@@ -102,6 +109,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
@@ -509,7 +519,11 @@ static bool matrix_task(void) {
 
     static matrix_row_t matrix_previous[MATRIX_ROWS];
 
-    matrix_scan();
+#if defined(KEYEVENT_HIRES_TIME) || defined(LATENCY_TRACER_ENABLE)
+    // Taken before the scan so that events carry the time the switches were read, not the time they were processed
+    const uint32_t scan_time_hires = timer_read_hires();
+#endif
+    SCAN_PROFILE(SCAN_PROFILER_MATRIX_SCAN, matrix_scan());
     bool matrix_changed = false;
     for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
         matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
@@ -543,7 +557,14 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+#ifdef KEYEVENT_HIRES_TIME
+                    event.time_hires = scan_time_hires;
+#endif
+#ifdef LATENCY_TRACER_ENABLE
+                    latency_tracer_key_event(scan_time_hires);
+#endif
+                    SCAN_PROFILE(SCAN_PROFILER_ACTION_EXEC, action_exec(event));
                 }
 
                 switch_events(row, col, key_pressed);
@@ -590,8 +611,14 @@ void quantum_task(void) {
     music_task();
 #endif
 
+    // Tasks of features with a timeout are only called once it is due
+    __attribute__((unused)) const uint32_t now                = timer_read32();
+    __attribute__((unused)) const bool     feature_timers_due = feature_timer_due(now);
+
 #ifdef KEY_OVERRIDE_ENABLE
-    key_override_task();
+    if (feature_timers_due && feature_timer_take(FEATURE_TIMER_KEY_OVERRIDE, now)) {
+        SCAN_PROFILE(SCAN_PROFILER_KEY_OVERRIDE_TASK, key_override_task());
+    }
 #endif
 
 #ifdef SEQUENCER_ENABLE
@@ -599,15 +626,21 @@ void quantum_task(void) {
 #endif
 
 #ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
+    if (feature_timers_due && feature_timer_take(FEATURE_TIMER_TAP_DANCE, now)) {
+        SCAN_PROFILE(SCAN_PROFILER_TAP_DANCE_TASK, tap_dance_task());
+    }
 #endif
 
 #ifdef COMBO_ENABLE
-    combo_task();
+    if (feature_timers_due && feature_timer_take(FEATURE_TIMER_COMBO, now)) {
+        SCAN_PROFILE(SCAN_PROFILER_COMBO_TASK, combo_task());
+    }
 #endif
 
 #ifdef LEADER_ENABLE
-    leader_task();
+    if (feature_timers_due && feature_timer_take(FEATURE_TIMER_LEADER, now)) {
+        SCAN_PROFILE(SCAN_PROFILER_LEADER_TASK, leader_task());
+    }
 #endif
 
 #ifdef WPM_ENABLE
@@ -619,41 +652,53 @@ void quantum_task(void) {
 #endif
 
 #ifdef AUTO_SHIFT_ENABLE
-    autoshift_matrix_scan();
+    if (feature_timers_due && feature_timer_take(FEATURE_TIMER_AUTO_SHIFT, now)) {
+        autoshift_matrix_scan();
+    }
 #endif
 
 #ifdef CAPS_WORD_ENABLE
-    caps_word_task();
+    if (feature_timers_due && feature_timer_take(FEATURE_TIMER_CAPS_WORD, now)) {
+        caps_word_task();
+    }
 #endif
 
 #ifdef SECURE_ENABLE
     secure_task();
 #endif
+
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_MIRROR)
+    dynamic_keymap_task();
+#endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
+    SCAN_PROFILE_BEGIN(SCAN_PROFILER_KEYBOARD_TASK);
+
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    bool                         matrix_changed;
+    SCAN_PROFILE(SCAN_PROFILER_MATRIX_TASK, matrix_changed = matrix_task());
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    SCAN_PROFILE(SCAN_PROFILER_QUANTUM_TASK, quantum_task());
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
+    SCAN_PROFILE(SCAN_PROFILER_RGBLIGHT_TASK, rgblight_task());
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    SCAN_PROFILE(SCAN_PROFILER_LED_MATRIX_TASK, led_matrix_task());
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    SCAN_PROFILE(SCAN_PROFILER_RGB_MATRIX_TASK, rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -677,7 +722,7 @@ void keyboard_task(void) {
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    SCAN_PROFILE(SCAN_PROFILER_OLED_TASK, oled_task());
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -685,7 +730,7 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ST7565_ENABLE
-    st7565_task();
+    SCAN_PROFILE(SCAN_PROFILER_ST7565_TASK, st7565_task());
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) st7565_on();
@@ -718,4 +763,10 @@ void keyboard_task(void) {
 #endif
 
     led_task();
+
+#ifdef KEYBOARD_REPORT_COALESCE
+    keyboard_report_coalesce_task();
+#endif
+
+    SCAN_PROFILE_END(SCAN_PROFILER_KEYBOARD_TASK);
 }
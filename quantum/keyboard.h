@@ -40,6 +40,9 @@ typedef struct {
     uint16_t        time;
     keyevent_type_t type;
     bool            pressed;
+#ifdef KEYEVENT_HIRES_TIME
+    uint32_t time_hires; // timer_read_hires() value of the matrix scan which produced the event
+#endif
 } keyevent_t;
 
 /* equivalent test of keypos_t */
@@ -69,7 +72,11 @@ static inline bool IS_ENCODEREVENT(const keyevent_t event) {
 #define MAKE_KEYPOS(row_num, col_num) ((keypos_t){.row = (row_num), .col = (col_num)})
 
 /* Common keyevent_t object factory */
-#define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = (event_type)})
+#ifdef KEYEVENT_HIRES_TIME
+#    define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = (event_type), .time_hires = timer_read_hires()})
+#else
+#    define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = (event_type)})
+#endif
 
 /**
  * @brief Constructs a key event for a pressed or released key.
@@ -86,6 +93,22 @@ static inline bool IS_ENCODEREVENT(const keyevent_t event) {
  */
 #define MAKE_TICK_EVENT MAKE_EVENT(0, 0, false, TICK_EVENT)
 
+#ifdef KEYEVENT_HIRES_TIME
+/**
+ * @brief Returns the number of microseconds between the high resolution timestamps of two events.
+ */
+static inline uint32_t keyevent_hires_diff_us(const keyevent_t later, const keyevent_t earlier) {
+    return timer_hires_to_us(TIMER_DIFF_32(later.time_hires, earlier.time_hires));
+}
+
+/**
+ * @brief Returns the number of microseconds elapsed since the event was captured.
+ */
+static inline uint32_t keyevent_hires_elapsed_us(const keyevent_t event) {
+    return timer_hires_to_us(TIMER_DIFF_32(timer_read_hires(), event.time_hires));
+}
+#endif
+
 #ifdef ENCODER_MAP_ENABLE
 /* Encoder events */
 #    define MAKE_ENCODER_CW_EVENT(enc_id, press) MAKE_EVENT(KEYLOC_ENCODER_CW, (enc_id), (press), ENCODER_CW_EVENT)
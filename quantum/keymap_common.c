@@ -41,8 +41,52 @@ extern keymap_config_t keymap_config;
 
 #include <inttypes.h>
 
+#ifdef KEYMAP_ACTION_CACHE
+#    include <string.h>
+#    include "matrix.h"
+
+#    ifndef KEYMAP_ACTION_CACHE_LAYERS
+#        define KEYMAP_ACTION_CACHE_LAYERS 4
+#    endif
+
+// Resolved action codes of every matrix position on the first KEYMAP_ACTION_CACHE_LAYERS layers, filled on first use
+static uint16_t action_cache[KEYMAP_ACTION_CACHE_LAYERS][MATRIX_ROWS][MATRIX_COLS];
+// One bit per entry of action_cache which holds a resolved action, as any action code may be cached
+static matrix_row_t action_cache_valid[KEYMAP_ACTION_CACHE_LAYERS][MATRIX_ROWS];
+// The keymap_config the cached actions were resolved with, as its swaps and remaps are baked into them
+static uint16_t action_cache_config = 0;
+
+void keymap_action_cache_invalidate(void) {
+    memset(action_cache_valid, 0, sizeof(action_cache_valid));
+}
+
+void keymap_action_cache_invalidate_key(uint8_t layer, uint8_t row, uint8_t col) {
+    if (layer < KEYMAP_ACTION_CACHE_LAYERS && row < MATRIX_ROWS && col < MATRIX_COLS) {
+        action_cache_valid[layer][row] &= ~((matrix_row_t)1 << col);
+    }
+}
+#endif
+
 /* converts key to action */
 action_t action_for_key(uint8_t layer, keypos_t key) {
+#ifdef KEYMAP_ACTION_CACHE
+    if (layer < KEYMAP_ACTION_CACHE_LAYERS && key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        if (keymap_config.raw != action_cache_config) {
+            keymap_action_cache_invalidate();
+            action_cache_config = keymap_config.raw;
+        }
+
+        uint16_t     *entry = &action_cache[layer][key.row][key.col];
+        matrix_row_t *valid = &action_cache_valid[layer][key.row];
+        matrix_row_t  mask  = (matrix_row_t)1 << key.col;
+        if (!(*valid & mask)) {
+            *entry = action_for_keycode(keymap_key_to_keycode(layer, key)).code;
+            *valid |= mask;
+        }
+        return (action_t){.code = *entry};
+    }
+#endif
+
     // 16bit keycodes - important
     uint16_t keycode = keymap_key_to_keycode(layer, key);
     return action_for_keycode(keycode);
@@ -8,3 +8,10 @@
 
 // translates key to keycode
 uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
+
+#ifdef KEYMAP_ACTION_CACHE
+// Drops every cached action, to be called whenever the keymap or keymap_config changes
+void keymap_action_cache_invalidate(void);
+// Drops the cached action of a single matrix position on a layer
+void keymap_action_cache_invalidate_key(uint8_t layer, uint8_t row, uint8_t col);
+#endif
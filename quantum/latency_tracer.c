@@ -0,0 +1,180 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "latency_tracer.h"
+#include "timer.h"
+#include "print.h"
+#include "debug.h"
+
+#if LATENCY_TRACER_HISTOGRAM_BUCKETS < 2 || LATENCY_TRACER_HISTOGRAM_BUCKETS > 64
+#    error "LATENCY_TRACER_HISTOGRAM_BUCKETS must be between 2 and 64"
+#endif
+
+typedef struct latency_tracer_stage_state_t {
+    timing_histogram_t summary;
+    uint16_t           histogram[LATENCY_TRACER_HISTOGRAM_BUCKETS];
+} latency_tracer_stage_state_t;
+
+static latency_tracer_stage_state_t stages[LATENCY_TRACER_STAGE_COUNT];
+static uint32_t                     interval_start = 0;
+
+static const char *const stage_names[LATENCY_TRACER_STAGE_COUNT] = {
+    [LATENCY_TRACER_DETECT_TO_QUEUE] = "detect_to_queue",
+    [LATENCY_TRACER_QUEUE_TO_SENT]   = "queue_to_sent",
+    [LATENCY_TRACER_DETECT_TO_SENT]  = "detect_to_sent",
+};
+
+// Latest key event which has not been reported yet
+static bool     event_pending = false;
+static uint32_t event_time;
+
+// Report handed to the driver, waiting for its transfer to start
+static volatile bool     report_queued = false;
+static volatile uint32_t report_event_time;
+static volatile uint32_t report_queue_time;
+
+// Report being transferred, and its completion time once done
+static volatile bool     transfer_active    = false;
+static volatile bool     transfer_completed = false;
+static volatile uint8_t  transfer_endpoint;
+static volatile uint32_t transfer_event_time;
+static volatile uint32_t transfer_queue_time;
+static volatile uint32_t transfer_complete_time;
+
+static void record(latency_tracer_stage_t stage, uint32_t start, uint32_t end) {
+    timing_histogram_record(&stages[stage].summary, stages[stage].histogram, LATENCY_TRACER_HISTOGRAM_BUCKETS, timer_hires_to_us(TIMER_DIFF_32(end, start)));
+}
+
+static void collect_completed_transfer(void) {
+    if (!transfer_completed) {
+        return;
+    }
+
+    record(LATENCY_TRACER_QUEUE_TO_SENT, transfer_queue_time, transfer_complete_time);
+    record(LATENCY_TRACER_DETECT_TO_SENT, transfer_event_time, transfer_complete_time);
+    transfer_completed = false;
+}
+
+void latency_tracer_key_event(uint32_t scan_time) {
+    event_pending = true;
+    event_time    = scan_time;
+}
+
+void latency_tracer_report_queued(void) {
+    report_queued = false;
+    if (!event_pending) {
+        return;
+    }
+    event_pending = false;
+
+    uint32_t now = timer_read_hires();
+    if (timer_hires_to_us(TIMER_DIFF_32(now, event_time)) > (uint32_t)LATENCY_TRACER_TIMEOUT * 1000) {
+        return;
+    }
+
+    record(LATENCY_TRACER_DETECT_TO_QUEUE, event_time, now);
+    report_event_time = event_time;
+    report_queue_time = now;
+    report_queued     = true;
+}
+
+void latency_tracer_transfer_started_i(uint8_t endpoint) {
+    // A previous completion which has not been collected yet would be overwritten, drop this one instead
+    if (!report_queued || transfer_completed) {
+        report_queued = false;
+        return;
+    }
+
+    transfer_endpoint   = endpoint;
+    transfer_event_time = report_event_time;
+    transfer_queue_time = report_queue_time;
+    transfer_active     = true;
+    report_queued       = false;
+}
+
+void latency_tracer_transfer_dropped_i(void) {
+    report_queued = false;
+}
+
+void latency_tracer_transfer_completed_i(uint8_t endpoint) {
+    if (!transfer_active || endpoint != transfer_endpoint) {
+        return;
+    }
+
+    transfer_complete_time = timer_read_hires();
+    transfer_active        = false;
+    transfer_completed     = true;
+}
+
+bool latency_tracer_get_stats(latency_tracer_stage_t stage, latency_tracer_stats_t *stats) {
+    if (stage >= LATENCY_TRACER_STAGE_COUNT) {
+        return false;
+    }
+
+    collect_completed_transfer();
+    timing_histogram_get_stats(&stages[stage].summary, stages[stage].histogram, LATENCY_TRACER_HISTOGRAM_BUCKETS, stats);
+    return true;
+}
+
+const char *latency_tracer_stage_name(latency_tracer_stage_t stage) {
+    if (stage >= LATENCY_TRACER_STAGE_COUNT) {
+        return "unknown";
+    }
+    return stage_names[stage];
+}
+
+void latency_tracer_reset(void) {
+    memset(stages, 0, sizeof(stages));
+}
+
+void latency_tracer_print(void) {
+    for (uint8_t i = 0; i < LATENCY_TRACER_STAGE_COUNT; i++) {
+        latency_tracer_stats_t stats;
+        if (!latency_tracer_get_stats(i, &stats) || stats.count == 0) {
+            continue;
+        }
+        uprintf("latency %-16s n=%lu min=%luus p50=%luus p99=%luus max=%luus mean=%luus\n", latency_tracer_stage_name(i), (unsigned long)stats.count, (unsigned long)stats.min, (unsigned long)stats.p50, (unsigned long)stats.p99, (unsigned long)stats.max, (unsigned long)stats.mean);
+    }
+}
+
+static void pack_u32(uint8_t *dest, uint32_t value) {
+    dest[0] = value & 0xFF;
+    dest[1] = (value >> 8) & 0xFF;
+    dest[2] = (value >> 16) & 0xFF;
+    dest[3] = (value >> 24) & 0xFF;
+}
+
+void latency_tracer_raw_hid_report(uint8_t *data, uint8_t length) {
+    if (length < 27) {
+        return;
+    }
+
+    latency_tracer_stats_t stats;
+    if (!latency_tracer_get_stats(data[1], &stats)) {
+        memset(&stats, 0, sizeof(stats));
+    }
+
+    data[2] = LATENCY_TRACER_STAGE_COUNT;
+    pack_u32(&data[3], stats.count);
+    pack_u32(&data[7], stats.min);
+    pack_u32(&data[11], stats.max);
+    pack_u32(&data[15], stats.mean);
+    pack_u32(&data[19], stats.p50);
+    pack_u32(&data[23], stats.p99);
+}
+
+void latency_tracer_task(void) {
+    collect_completed_transfer();
+
+    if (timer_elapsed32(interval_start) < LATENCY_TRACER_INTERVAL) {
+        return;
+    }
+    interval_start = timer_read32();
+
+#ifdef CONSOLE_ENABLE
+    if (debug_enable) {
+        latency_tracer_print();
+    }
+#endif
+}
@@ -0,0 +1,110 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "timing_histogram.h"
+
+/*
+    The latency tracer measures how long key events take to reach the host, in microseconds.
+
+    A key event is stamped with the time of the matrix scan which detected it. When the resulting keyboard or
+    NKRO report is handed to the host driver, the time since the latest detected event is recorded, and the
+    report is stamped again. Drivers which can tell when the IN transfer of a report has completed (ChibiOS)
+    stamp it a third time, giving the time spent waiting for the endpoint and the host's poll.
+
+    Each stage is accumulated into a logarithmic histogram until latency_tracer_reset() is called.
+*/
+
+#ifndef LATENCY_TRACER_HISTOGRAM_BUCKETS
+#    define LATENCY_TRACER_HISTOGRAM_BUCKETS 32
+#endif
+
+// Events which have not produced a report after this many milliseconds are not attributed to a later report
+#ifndef LATENCY_TRACER_TIMEOUT
+#    define LATENCY_TRACER_TIMEOUT 1000
+#endif
+
+#ifndef LATENCY_TRACER_INTERVAL
+#    define LATENCY_TRACER_INTERVAL 10000
+#endif
+
+typedef enum latency_tracer_stage_t {
+    LATENCY_TRACER_DETECT_TO_QUEUE,
+    LATENCY_TRACER_QUEUE_TO_SENT,
+    LATENCY_TRACER_DETECT_TO_SENT,
+    LATENCY_TRACER_STAGE_COUNT,
+} latency_tracer_stage_t;
+
+typedef timing_histogram_stats_t latency_tracer_stats_t;
+
+/**
+ * @brief Marks a key event detected by the matrix scan which started at `scan_time`, in timer_read_hires() ticks.
+ */
+void latency_tracer_key_event(uint32_t scan_time);
+
+/**
+ * @brief Marks a keyboard or NKRO report being handed to the host driver.
+ */
+void latency_tracer_report_queued(void);
+
+/**
+ * @brief Called by the USB driver, with interrupts locked, right before starting the IN transfer of a report.
+ */
+void latency_tracer_transfer_started_i(uint8_t endpoint);
+
+/**
+ * @brief Called by the USB driver, with interrupts locked, when a keyboard or NKRO report is dropped instead of being transferred.
+ */
+void latency_tracer_transfer_dropped_i(void);
+
+/**
+ * @brief Called by the USB driver from its IN completion callback.
+ */
+void latency_tracer_transfer_completed_i(uint8_t endpoint);
+
+/**
+ * @brief Computes summary statistics, in microseconds, for the given stage.
+ *
+ * @return false if the stage is out of range
+ */
+bool latency_tracer_get_stats(latency_tracer_stage_t stage, latency_tracer_stats_t *stats);
+
+/**
+ * @brief Returns a printable name for the given stage.
+ */
+const char *latency_tracer_stage_name(latency_tracer_stage_t stage);
+
+/**
+ * @brief Clears all accumulated statistics.
+ */
+void latency_tracer_reset(void);
+
+/**
+ * @brief Prints statistics for every stage which has samples to the console.
+ */
+void latency_tracer_print(void);
+
+/**
+ * @brief Fills a raw HID report with the statistics of the stage requested in `data[1]`.
+ *
+ * Layout of the response, all values little-endian and in microseconds:
+ *   data[1]        requested stage
+ *   data[2]        total number of stages
+ *   data[3..6]     count
+ *   data[7..10]    min
+ *   data[11..14]   max
+ *   data[15..18]   mean
+ *   data[19..22]   p50
+ *   data[23..26]   p99
+ *
+ * `data[0]` is left untouched so that it can hold the caller's command ID.
+ */
+void latency_tracer_raw_hid_report(uint8_t *data, uint8_t length);
+
+/**
+ * @brief Collects completed transfers and periodically prints results if the console is enabled. Should not be invoked by keyboard/user code.
+ */
+void latency_tracer_task(void);
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "leader.h"
+#include "feature_timer.h"
 #include "timer.h"
 #include "util.h"
 
@@ -30,6 +31,7 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+    feature_timer_schedule(FEATURE_TIMER_LEADER, 0);
 }
 
 void leader_end(void) {
@@ -38,9 +40,22 @@ void leader_end(void) {
 }
 
 void leader_task(void) {
-    if (leader_sequence_active() && leader_sequence_timed_out()) {
+    if (!leader_sequence_active()) {
+        return;
+    }
+
+    if (leader_sequence_timed_out()) {
         leader_end();
+        return;
+    }
+
+#if defined(LEADER_NO_TIMEOUT)
+    // The timeout only starts with the first key of the sequence
+    if (leader_sequence_size == 0) {
+        return;
     }
+#endif
+    feature_timer_schedule(FEATURE_TIMER_LEADER, LEADER_TIMEOUT - timer_elapsed(leader_time) + 1);
 }
 
 bool leader_sequence_active(void) {
@@ -74,6 +89,7 @@ bool leader_sequence_timed_out(void) {
 
 void leader_reset_timer(void) {
     leader_time = timer_read();
+    feature_timer_schedule(FEATURE_TIMER_LEADER, 0);
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
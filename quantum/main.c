@@ -15,6 +15,10 @@
  */
 
 #include "keyboard.h"
+#include "scan_profiler.h"
+#ifdef LATENCY_TRACER_ENABLE
+#    include "latency_tracer.h"
+#endif
 
 void platform_setup(void);
 
@@ -62,15 +66,23 @@ int main(void) {
 #ifdef QUANTUM_PAINTER_ENABLE
         // Run Quantum Painter task
         void qp_internal_task(void);
-        qp_internal_task();
+        SCAN_PROFILE(SCAN_PROFILER_PAINTER_TASK, qp_internal_task());
 #endif
 
 #ifdef DEFERRED_EXEC_ENABLE
         // Run deferred executions
         void deferred_exec_task(void);
-        deferred_exec_task();
+        SCAN_PROFILE(SCAN_PROFILER_DEFERRED_EXEC_TASK, deferred_exec_task());
 #endif // DEFERRED_EXEC_ENABLE
 
-        housekeeping_task();
+        SCAN_PROFILE(SCAN_PROFILER_HOUSEKEEPING_TASK, housekeeping_task());
+
+#ifdef SCAN_PROFILER_ENABLE
+        scan_profiler_task();
+#endif // SCAN_PROFILER_ENABLE
+
+#ifdef LATENCY_TRACER_ENABLE
+        latency_tracer_task();
+#endif // LATENCY_TRACER_ENABLE
     }
 }
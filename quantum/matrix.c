@@ -20,7 +20,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "util.h"
 #include "matrix.h"
 #include "debounce.h"
+#include "scan_profiler.h"
 #include "atomic_util.h"
+#include "timer.h"
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -51,6 +53,23 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define MATRIX_INPUT_PRESSED_STATE 0
 #endif
 
+#ifdef MATRIX_SCAN_ON_INTERRUPT
+#    if !defined(PROTOCOL_CHIBIOS)
+#        error MATRIX_SCAN_ON_INTERRUPT is only supported on ChibiOS
+#    elif defined(DIRECT_PINS) || !defined(MATRIX_ROW_PINS) || !defined(MATRIX_COL_PINS)
+#        error MATRIX_SCAN_ON_INTERRUPT requires MATRIX_ROW_PINS and MATRIX_COL_PINS
+#    elif !defined(PAL_USE_CALLBACKS) || (PAL_USE_CALLBACKS != TRUE)
+#        error MATRIX_SCAN_ON_INTERRUPT requires PAL_USE_CALLBACKS to be enabled in halconf.h
+#    endif
+#    ifndef DEBOUNCE
+#        define DEBOUNCE 5
+#    endif
+#    ifndef MATRIX_INTERRUPT_IDLE_WAIT
+#        define MATRIX_INTERRUPT_IDLE_WAIT 0
+#    endif
+#    include "debug.h"
+#endif
+
 #ifdef DIRECT_PINS
 static SPLIT_MUTABLE pin_t direct_pins[ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS;
 #elif (DIODE_DIRECTION == ROW2COL) || (DIODE_DIRECTION == COL2ROW)
@@ -270,6 +289,149 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#ifdef MATRIX_SCAN_ON_INTERRUPT
+/*
+ * While no key is down and debounce has settled, all output lines are driven active at the same time and the
+ * input lines are armed as pin-change interrupts. Scanning is skipped until one of them fires, after which the
+ * normal scan runs until the matrix is released again.
+ */
+#    if (DIODE_DIRECTION == COL2ROW)
+#        define MATRIX_DRIVE_PINS row_pins
+#        define MATRIX_DRIVE_COUNT ROWS_PER_HAND
+#        define MATRIX_SENSE_PINS col_pins
+#        define MATRIX_SENSE_COUNT MATRIX_COLS
+#        define unselect_all() unselect_rows()
+#    else
+#        define MATRIX_DRIVE_PINS col_pins
+#        define MATRIX_DRIVE_COUNT MATRIX_COLS
+#        define MATRIX_SENSE_PINS row_pins
+#        define MATRIX_SENSE_COUNT ROWS_PER_HAND
+#        define unselect_all() unselect_cols()
+#    endif
+
+#    if MATRIX_INPUT_PRESSED_STATE == 0
+#        define MATRIX_INTERRUPT_EDGE PAL_EVENT_MODE_FALLING_EDGE
+#    else
+#        define MATRIX_INTERRUPT_EDGE PAL_EVENT_MODE_RISING_EDGE
+#    endif
+
+static volatile bool matrix_interrupt_pending = false;
+static bool          matrix_interrupt_usable  = false;
+static bool          matrix_idle              = false;
+static uint16_t      matrix_last_activity     = 0;
+#    if MATRIX_INTERRUPT_IDLE_WAIT > 0
+static binary_semaphore_t matrix_wake;
+#    endif
+
+static void matrix_interrupt_callback(void *arg) {
+    (void)arg;
+    matrix_interrupt_pending = true;
+#    if MATRIX_INTERRUPT_IDLE_WAIT > 0
+    chSysLockFromISR();
+    chBSemSignalI(&matrix_wake);
+    chSysUnlockFromISR();
+#    endif
+}
+
+/**
+ * @brief Checks that a press on any input line can raise its own interrupt. On STM32, the pins with the same
+ * number on different ports share one EXTI line, which only follows the last of them to be armed.
+ */
+static bool matrix_interrupt_pins_valid(void) {
+#    ifdef MCU_STM32
+    uint32_t pads = 0;
+    for (uint8_t x = 0; x < MATRIX_SENSE_COUNT; x++) {
+        pin_t pin = MATRIX_SENSE_PINS[x];
+        if (pin == NO_PIN) {
+            continue;
+        }
+        if (pads & (1UL << PAL_PAD(pin))) {
+            dprintf("matrix: input pins share EXTI line %u, scanning continuously\n", (unsigned)PAL_PAD(pin));
+            return false;
+        }
+        pads |= 1UL << PAL_PAD(pin);
+    }
+#    endif
+    return true;
+}
+
+static void matrix_enter_idle(void) {
+    for (uint8_t x = 0; x < MATRIX_DRIVE_COUNT; x++) {
+        if (MATRIX_DRIVE_PINS[x] != NO_PIN) {
+            setPinOutput_writeLow(MATRIX_DRIVE_PINS[x]);
+        }
+    }
+    matrix_output_select_delay();
+
+    matrix_interrupt_pending = false;
+    for (uint8_t x = 0; x < MATRIX_SENSE_COUNT; x++) {
+        pin_t pin = MATRIX_SENSE_PINS[x];
+        if (pin != NO_PIN) {
+            palEnableLineEvent(pin, MATRIX_INTERRUPT_EDGE);
+            palSetLineCallback(pin, matrix_interrupt_callback, NULL);
+            // A key pressed while arming would not produce an edge, so check the levels once
+            if (readPin(pin) == MATRIX_INPUT_PRESSED_STATE) {
+                matrix_interrupt_pending = true;
+            }
+        }
+    }
+
+    matrix_idle = true;
+}
+
+static void matrix_leave_idle(void) {
+    for (uint8_t x = 0; x < MATRIX_SENSE_COUNT; x++) {
+        if (MATRIX_SENSE_PINS[x] != NO_PIN) {
+            palDisableLineEvent(MATRIX_SENSE_PINS[x]);
+        }
+    }
+
+    unselect_all();
+    matrix_output_unselect_delay(0, true); // wait for all input signals to go HIGH
+
+    matrix_idle = false;
+}
+
+/**
+ * @brief Decides whether the matrix has to be scanned in this iteration.
+ */
+static bool matrix_scan_needed(void) {
+    if (!matrix_idle) {
+        return true;
+    }
+
+#    if MATRIX_INTERRUPT_IDLE_WAIT > 0
+    if (!matrix_interrupt_pending) {
+        chBSemWaitTimeout(&matrix_wake, TIME_MS2I(MATRIX_INTERRUPT_IDLE_WAIT));
+    }
+#    endif
+
+    if (!matrix_interrupt_pending) {
+        return false;
+    }
+
+    matrix_leave_idle();
+    matrix_last_activity = timer_read();
+    return true;
+}
+
+/**
+ * @brief Arms the pin-change interrupts once the matrix is released and debounce has settled.
+ */
+static void matrix_update_idle(const matrix_row_t current_matrix[], bool changed) {
+    bool any_pressed = false;
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        any_pressed |= current_matrix[row] != 0;
+    }
+
+    if (any_pressed || changed) {
+        matrix_last_activity = timer_read();
+    } else if (matrix_interrupt_usable && timer_elapsed(matrix_last_activity) > DEBOUNCE) {
+        matrix_enter_idle();
+    }
+}
+#endif // MATRIX_SCAN_ON_INTERRUPT
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
@@ -303,6 +465,15 @@ void matrix_init(void) {
     // initialize key pins
     matrix_init_pins();
 
+#ifdef MATRIX_SCAN_ON_INTERRUPT
+#    if MATRIX_INTERRUPT_IDLE_WAIT > 0
+    chBSemObjectInit(&matrix_wake, true);
+#    endif
+    // Checked once the pins of this half are known
+    matrix_interrupt_usable = matrix_interrupt_pins_valid();
+    matrix_last_activity    = timer_read();
+#endif
+
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
     memset(raw_matrix, 0, sizeof(raw_matrix));
@@ -321,28 +492,39 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 #endif
 
 uint8_t matrix_scan(void) {
-    matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
+    bool changed = false;
+
+#ifdef MATRIX_SCAN_ON_INTERRUPT
+    if (matrix_scan_needed()) {
+#endif
+        matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
-    // Set row, read cols
-    for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
-        matrix_read_cols_on_row(curr_matrix, current_row);
-    }
+        // Set row, read cols
+        for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
+            matrix_read_cols_on_row(curr_matrix, current_row);
+        }
 #elif (DIODE_DIRECTION == ROW2COL)
-    // Set col, read rows
-    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
-    for (uint8_t current_col = 0; current_col < MATRIX_COLS; current_col++, row_shifter <<= 1) {
-        matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
-    }
+        // Set col, read rows
+        matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+        for (uint8_t current_col = 0; current_col < MATRIX_COLS; current_col++, row_shifter <<= 1) {
+            matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
+        }
 #endif
 
-    bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
-    if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
+        changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
+        if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
+
+#ifdef MATRIX_SCAN_ON_INTERRUPT
+        matrix_update_idle(curr_matrix, changed);
+    }
+#endif
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+    SCAN_PROFILE(SCAN_PROFILER_DEBOUNCE, changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed));
+    changed |= matrix_post_scan();
 #else
-    changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+    SCAN_PROFILE(SCAN_PROFILER_DEBOUNCE, changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed));
     matrix_scan_kb();
 #endif
     return (uint8_t)changed;
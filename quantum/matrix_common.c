@@ -1,5 +1,6 @@
 #include "matrix.h"
 #include "debounce.h"
+#include "scan_profiler.h"
 #include "wait.h"
 #include "print.h"
 #include "debug.h"
@@ -97,7 +98,9 @@ bool matrix_post_scan(void) {
     if (is_keyboard_master()) {
         static bool  last_connected              = false;
         matrix_row_t slave_matrix[ROWS_PER_HAND] = {0};
-        if (transport_master_if_connected(matrix + thisHand, slave_matrix)) {
+        bool         connected;
+        SCAN_PROFILE(SCAN_PROFILER_SPLIT_TRANSACTIONS, connected = transport_master_if_connected(matrix + thisHand, slave_matrix));
+        if (connected) {
             changed = memcmp(matrix + thatHand, slave_matrix, sizeof(slave_matrix)) != 0;
 
             last_connected = true;
@@ -113,7 +116,7 @@ bool matrix_post_scan(void) {
 
         matrix_scan_kb();
     } else {
-        transport_slave(matrix + thatHand, matrix + thisHand);
+        SCAN_PROFILE(SCAN_PROFILER_SPLIT_TRANSACTIONS, transport_slave(matrix + thatHand, matrix + thisHand));
 
         matrix_slave_scan_kb();
     }
@@ -169,9 +172,10 @@ __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+    SCAN_PROFILE(SCAN_PROFILER_DEBOUNCE, changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed));
+    changed |= matrix_post_scan();
 #else
-    changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+    SCAN_PROFILE(SCAN_PROFILER_DEBOUNCE, changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed));
     matrix_scan_kb();
 #endif
 
@@ -324,8 +324,8 @@ typedef struct animation_state_t {
     deferred_token         defer_token;
 } animation_state_t;
 
-static deferred_executor_t animation_executors[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
-static animation_state_t   animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS]    = {0};
+DEFERRED_EXEC_QUEUE(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS);
+static animation_state_t animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
 
 static deferred_token qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
     qgf_frame_info_t frame_info = {0};
@@ -388,7 +388,7 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
     }
 
     // Set up the timer
-    anim_state->defer_token = defer_exec_advanced(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, delay_ms, animation_callback, anim_state);
+    anim_state->defer_token = defer_exec_queue(&animation_executors, delay_ms, animation_callback, anim_state);
     if (anim_state->defer_token == INVALID_DEFERRED_TOKEN) {
         anim_state->device = NULL; // disregard the allocated animation slot
         qp_dprintf("qp_animate_recolor: fail (could not set up animation executor)\n");
@@ -405,7 +405,7 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
 void qp_stop_animation(deferred_token anim_token) {
     for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
         if (animation_states[i].defer_token == anim_token) {
-            cancel_deferred_exec_advanced(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, anim_token);
+            cancel_deferred_exec_queue(&animation_executors, anim_token);
             animation_states[i].device = NULL;
             return;
         }
@@ -416,6 +416,5 @@ void qp_stop_animation(deferred_token anim_token) {
 // Quantum Painter Core API: qp_internal_animation_tick
 
 void qp_internal_animation_tick(void) {
-    static uint32_t last_anim_exec = 0;
-    deferred_exec_advanced_task(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, &last_anim_exec);
+    deferred_exec_queue_task(&animation_executors);
 }
@@ -77,9 +77,126 @@
 
 #define DICTIONARY_SIZE 1104
 
+#ifdef AUTOCORRECT_AUTOMATON
+#    define AUTOCORRECT_AUTOMATON_STATES 391
+#    define AUTOCORRECT_AUTOMATON_FIRST_MATCH 321
+#    define AUTOCORRECT_AUTOMATON_BOUNDARY 1
+#    define AUTOCORRECT_AUTOMATON_EDGES 390
+#    define AUTOCORRECT_AUTOMATON_CORRECTIONS_SIZE 414
+
+static const uint16_t autocorrect_automaton_fail[AUTOCORRECT_AUTOMATON_STATES] PROGMEM = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 17, 4, 14, 0, 0, 2, 8, 9, 13, 0,
+    2, 9, 10, 13, 15, 2, 18, 0, 12, 0, 9, 13, 2, 2, 4, 18, 0, 13, 15, 16, 0, 2, 0, 9, 17, 19, 8, 5,
+    9, 37, 57, 18, 4, 29, 2, 14, 18, 4, 18, 38, 13, 0, 10, 12, 16, 15, 10, 16, 17, 2, 19, 51, 18, 2,
+    9, 4, 17, 0, 12, 2, 3, 16, 13, 12, 11, 4, 14, 0, 16, 9, 18, 4, 6, 10, 14, 17, 18, 6, 14, 39, 9,
+    15, 59, 17, 15, 14, 5, 84, 38, 9, 15, 29, 11, 15, 2, 9, 18, 8, 85, 13, 10, 10, 4, 17, 12, 0, 40,
+    10, 10, 16, 2, 0, 15, 15, 7, 15, 10, 0, 14, 10, 7, 16, 2, 55, 16, 46, 0, 0, 26, 18, 17, 18, 15,
+    55, 0, 0, 28, 0, 40, 9, 15, 18, 16, 17, 17, 0, 7, 15, 9, 17, 9, 51, 2, 8, 7, 1, 0, 11, 11, 51,
+    15, 15, 15, 2, 7, 16, 41, 40, 0, 9, 9, 40, 15, 18, 2, 2, 17, 2, 18, 15, 18, 41, 8, 54, 15, 12,
+    53, 6, 16, 16, 15, 18, 9, 111, 9, 5, 72, 15, 0, 17, 18, 10, 15, 0, 15, 0, 12, 7, 57, 4, 16, 17,
+    21, 13, 13, 12, 51, 2, 15, 16, 53, 39, 7, 12, 2, 0, 0, 12, 17, 15, 0, 2, 90, 13, 0, 16, 32, 52,
+    14, 16, 51, 5, 13, 10, 0, 51, 0, 9, 2, 13, 61, 5, 5, 12, 12, 51, 37, 16, 12, 4, 17, 0, 4, 17,
+    16, 23, 4, 54, 40, 12, 17, 17, 10, 119, 2, 2, 12, 18, 0, 27, 13, 4, 26, 13, 5, 9, 17, 17, 7, 13,
+    51, 6, 17, 16, 40, 53, 97, 17, 12, 17, 0, 15, 51, 17, 15, 5, 57, 17, 17, 0, 17, 13, 12, 17, 12,
+    0, 5, 7, 12, 4, 27, 0, 17, 53, 12, 7, 5, 5, 5, 12, 15, 1, 5, 30, 12, 0, 5, 17, 17, 0, 16, 0, 0,
+    55, 17, 0, 5, 186, 17, 16, 0, 0, 15, 0, 0, 12, 0, 0, 0, 12
+};
+
+static const uint16_t autocorrect_automaton_edges[AUTOCORRECT_AUTOMATON_FIRST_MATCH + 1] PROGMEM = {
+    0, 19, 21, 24, 25, 29, 30, 35, 37, 38, 39, 42, 43, 44, 47, 50, 51, 56, 57, 58, 59, 60, 62, 64,
+    66, 67, 68, 69, 71, 72, 75, 76, 78, 79, 80, 81, 82, 83, 84, 85, 88, 89, 92, 93, 94, 95, 96, 97,
+    98, 99, 100, 101, 107, 108, 109, 110, 112, 114, 115, 116, 117, 118, 120, 121, 122, 123, 124,
+    125, 126, 127, 128, 129, 130, 131, 132, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+    146, 147, 149, 150, 151, 152, 153, 154, 156, 157, 158, 160, 162, 163, 164, 165, 166, 167, 168,
+    169, 170, 172, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+    190, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
+    248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 261, 262, 263, 264, 265, 266, 267,
+    268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286,
+    287, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306,
+    307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325,
+    326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+    345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363,
+    364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382,
+    383, 384, 385, 386, 387, 388, 389, 390
+};
+
+static const uint8_t autocorrect_automaton_keys[AUTOCORRECT_AUTOMATON_EDGES] PROGMEM = {
+    4, 5, 6, 7, 9, 10, 11, 12, 15, 16, 17, 18, 19, 21, 22, 23, 24, 26, 44, 10, 23, 6, 19, 20, 8, 4,
+    11, 12, 18, 8, 4, 12, 15, 18, 21, 4, 24, 8, 17, 8, 12, 18, 4, 4, 6, 24, 25, 18, 21, 22, 8, 4, 8,
+    12, 23, 26, 11, 7, 12, 24, 11, 24, 6, 18, 4, 19, 24, 6, 24, 8, 18, 8, 15, 17, 22, 21, 15, 22,
+    23, 4, 26, 8, 24, 4, 12, 6, 23, 25, 17, 4, 5, 22, 18, 17, 16, 6, 19, 8, 22, 12, 24, 6, 9, 15,
+    19, 23, 24, 9, 19, 17, 12, 21, 12, 23, 21, 19, 7, 4, 8, 12, 21, 18, 16, 21, 4, 12, 24, 11, 12,
+    18, 15, 15, 6, 23, 17, 25, 8, 15, 15, 22, 4, 20, 21, 21, 10, 21, 15, 8, 19, 15, 10, 22, 4, 23,
+    22, 24, 8, 8, 4, 24, 23, 24, 21, 23, 25, 8, 12, 8, 8, 12, 21, 24, 22, 23, 23, 8, 10, 21, 12, 23,
+    12, 8, 4, 11, 10, 44, 8, 8, 16, 16, 8, 21, 21, 21, 4, 10, 9, 22, 12, 8, 8, 12, 23, 12, 22, 8, 8,
+    8, 21, 24, 4, 4, 23, 4, 24, 21, 24, 12, 11, 12, 21, 17, 8, 19, 9, 22, 22, 21, 24, 23, 12, 12,
+    12, 7, 8, 21, 25, 23, 24, 17, 15, 21, 8, 21, 8, 17, 10, 11, 6, 22, 23, 23, 8, 23, 21, 18, 18,
+    17, 8, 4, 21, 8, 22, 23, 8, 17, 10, 17, 4, 8, 21, 7, 8, 17, 23, 11, 21, 8, 4, 23, 4, 23, 18, 28,
+    8, 22, 12, 4, 19, 22, 8, 23, 7, 18, 15, 18, 25, 8, 8, 12, 17, 23, 17, 28, 4, 7, 10, 17, 6, 11,
+    18, 8, 11, 7, 7, 23, 17, 17, 8, 8, 17, 10, 24, 22, 17, 7, 6, 23, 8, 6, 7, 23, 7, 17, 21, 44, 22,
+    19, 6, 12, 7, 8, 17, 8, 8, 7, 17, 23, 23, 15, 8, 4, 4, 23, 23, 17, 8, 24, 22, 28, 8, 8, 11, 18,
+    23, 6, 4, 18, 7, 23, 12, 8, 7, 44, 23, 23, 23, 22, 8, 28, 21, 8, 8, 17, 10, 18, 8, 8, 8, 17
+};
+
+static const uint16_t autocorrect_automaton_targets[AUTOCORRECT_AUTOMATON_EDGES] PROGMEM = {
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 1, 20, 21, 22, 23, 24, 25, 26,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74,
+    75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98,
+    99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
+    137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
+    156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+    175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 321, 188, 189, 190, 191, 192,
+    193, 194, 195, 322, 196, 197, 198, 199, 200, 323, 201, 324, 325, 202, 326, 203, 204, 205, 206,
+    207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 327, 218, 219, 220, 221, 222, 328, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 329, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 330, 331, 243, 332, 244, 245, 246, 247, 248, 249, 333, 250, 334, 251, 252, 253, 254, 255,
+    256, 335, 336, 257, 258, 259, 337, 260, 261, 262, 338, 263, 339, 264, 340, 265, 266, 267, 268,
+    269, 270, 271, 341, 272, 273, 274, 342, 275, 276, 277, 278, 343, 344, 345, 346, 279, 347, 348,
+    349, 350, 351, 280, 352, 281, 282, 283, 353, 284, 285, 286, 354, 355, 356, 287, 288, 289, 357,
+    290, 291, 292, 293, 358, 294, 359, 360, 361, 362, 295, 296, 297, 298, 363, 364, 365, 299, 366,
+    367, 300, 301, 302, 303, 304, 305, 306, 368, 369, 307, 370, 308, 371, 372, 309, 373, 310, 311,
+    374, 312, 313, 314, 315, 375, 316, 376, 377, 378, 317, 318, 379, 380, 381, 382, 383, 384, 385,
+    386, 319, 320, 387, 388, 389, 390
+};
+
+static const uint16_t autocorrect_automaton_matches[AUTOCORRECT_AUTOMATON_STATES - AUTOCORRECT_AUTOMATON_FIRST_MATCH] PROGMEM = {
+    0, 5, 10, 15, 19, 24, 30, 35, 41, 45, 49, 55, 60, 68, 73, 79, 86, 90, 95, 99, 105, 111, 117,
+    122, 128, 134, 139, 145, 151, 155, 159, 165, 172, 180, 186, 191, 199, 205, 209, 215, 221, 227,
+    232, 237, 243, 250, 256, 261, 269, 274, 280, 286, 291, 297, 304, 309, 316, 322, 324, 329, 337,
+    347, 357, 366, 372, 377, 382, 390, 401, 405
+};
+
+static const uint8_t autocorrect_automaton_corrections[AUTOCORRECT_AUTOMATON_CORRECTIONS_SIZE] PROGMEM = {
+    130, 114, 117, 101, 0, 130, 105, 101, 102, 0, 130, 110, 115, 116, 0, 129, 115, 101, 0, 130, 108,
+    115, 101, 0, 131, 97, 108, 115, 101, 0, 129, 107, 117, 112, 0, 130, 116, 112, 117, 116, 0, 128,
+    114, 110, 0, 129, 116, 104, 0, 131, 97, 117, 103, 101, 0, 130, 101, 105, 114, 0, 132, 99, 113,
+    117, 105, 114, 101, 0, 130, 103, 104, 116, 0, 131, 108, 116, 101, 114, 0, 131, 114, 119, 97,
+    114, 100, 0, 129, 104, 116, 0, 131, 112, 117, 116, 0, 129, 116, 104, 0, 130, 114, 97, 114, 121,
+    0, 131, 116, 112, 117, 116, 0, 131, 101, 117, 100, 111, 0, 130, 117, 114, 110, 0, 131, 115, 117,
+    108, 116, 0, 131, 116, 117, 114, 110, 0, 130, 101, 116, 121, 0, 131, 103, 110, 101, 100, 0, 131,
+    114, 105, 110, 103, 0, 129, 110, 103, 0, 129, 99, 104, 0, 131, 105, 116, 99, 104, 0, 132, 112,
+    100, 97, 116, 101, 0, 132, 112, 97, 114, 101, 110, 116, 0, 131, 97, 117, 115, 101, 0, 131, 115,
+    101, 110, 0, 133, 101, 105, 108, 105, 110, 103, 0, 131, 105, 118, 101, 100, 0, 129, 100, 101, 0,
+    131, 97, 108, 105, 100, 0, 131, 105, 115, 111, 110, 0, 130, 101, 110, 101, 114, 0, 132, 115,
+    101, 115, 0, 129, 114, 101, 100, 0, 130, 114, 105, 100, 101, 0, 131, 105, 116, 105, 111, 110, 0,
+    131, 101, 105, 118, 101, 0, 129, 114, 101, 100, 0, 133, 112, 97, 114, 101, 110, 116, 0, 130,
+    101, 110, 116, 0, 130, 97, 103, 117, 101, 0, 131, 97, 105, 110, 115, 0, 129, 110, 99, 121, 0,
+    130, 110, 116, 101, 101, 0, 132, 105, 102, 101, 115, 116, 0, 130, 97, 110, 116, 0, 132, 97, 114,
+    97, 116, 101, 0, 130, 104, 111, 108, 100, 0, 132, 0, 131, 101, 110, 116, 0, 133, 115, 101, 110,
+    115, 117, 115, 0, 135, 117, 97, 114, 97, 110, 116, 101, 101, 0, 135, 105, 101, 114, 97, 114, 99,
+    104, 121, 0, 135, 116, 101, 114, 97, 116, 111, 114, 0, 131, 112, 97, 99, 101, 0, 130, 97, 99,
+    101, 0, 131, 105, 111, 110, 0, 132, 109, 111, 100, 97, 116, 101, 0, 135, 99, 111, 109, 109, 111,
+    100, 97, 116, 101, 0, 130, 103, 101, 0, 134, 101, 116, 105, 116, 105, 111, 110, 0
+};
+#else
 static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {108, 43,  0,   6,   71, 0,  7,   81, 0,   8,   199, 0,   9,   240, 1,  10,  250, 1,  11,  26,  2,   17,  53,  2,   18, 190, 2,   19,  202, 2,   21,  212, 2,   22,  20,  3,   23,  67,  3,   28,  16,  4,   0,  72,  50,  0,   22,  60,  0,   0,   11,  23,  44, 8,   11, 23,  44,  0,   132, 0,   8,   22,  18,  18,  15,  0,  132, 115, 101, 115, 0,   11,  23,  12,  26,  22,  0,   129, 99,  104, 0,   68,  94,  0,   8,   106, 0,   15, 174, 0,   21, 187, 0,   0,   12,  15,  25,  17,  12,  0,   131, 97,  108, 105, 100, 0,   74,  119, 0,   12,  129, 0,   21,  140, 0,   24,  165, 0,   0,   17,  12,  22,  0,   131, 103, 110, 101, 100, 0,   25,  21, 8,   7,   0,   131, 105, 118, 101, 100, 0,   72,  147, 0,  24,  156, 0,  0,   9,   8,   21,  0,   129, 114, 101, 100, 0,   6,   6,   18,  0,   129, 114, 101, 100, 0,   15,  6,   17,  12,  0,   129, 100, 101, 0,   18, 22,  8,   21,  11,  23,  0,   130, 104, 111,
                                                                   108, 100, 0,   4,   26, 18, 9,   0,  131, 114, 119, 97,  114, 100, 0,  68,  233, 0,  6,   246, 0,   7,   4,   1,   8,  16,  1,   10,  52,  1,   15,  81,  1,   21,  90,  1,   22,  117, 1,   23,  144, 1,   24, 215, 1,   25,  228, 1,   0,   6,   19,  22,  8,  16,  4,  17,  0,   130, 97,  99,  101, 0,   19,  4,   22,  8,  16,  4,   17,  0,   131, 112, 97,  99,  101, 0,   12,  21,  8,   25,  18,  0,   130, 114, 105, 100, 101, 0,  23,  0,   68, 25,  1,   17,  36,  1,   0,   21,  4,   24,  10,  0,   130, 110, 116, 101, 101, 0,   4,   21,  24,  4,   10,  0,   135, 117, 97,  114, 97,  110, 116, 101, 101, 0,   68,  59,  1,   7,   69,  1,   0,  24,  10,  44,  0,   131, 97,  117, 103, 101, 0,   8,   15, 12,  25,  12, 21,  19,  0,   130, 103, 101, 0,   22,  4,   9,   0,   130, 108, 115, 101, 0,   76,  97,  1,   24,  109, 1,   0,   24,  20,  4,   0,   132, 99, 113, 117, 105, 114, 101, 0,   23,  44,  0,
                                                                   130, 114, 117, 101, 0,  4,  0,   79, 126, 1,   24,  134, 1,   0,   9,  0,   131, 97, 108, 115, 101, 0,   6,   8,   5,  0,   131, 97,  117, 115, 101, 0,   4,   0,   71,  156, 1,   19,  193, 1,   21,  203, 1,  0,   18,  16,  0,   80,  166, 1,   18,  181, 1,  0,   18, 6,   4,   0,   135, 99,  111, 109, 109, 111, 100, 97, 116, 101, 0,   6,   6,   4,   0,   132, 109, 111, 100, 97,  116, 101, 0,   7,   24,  0,   132, 112, 100, 97, 116, 101, 0,  8,   19,  8,   22,  0,   132, 97,  114, 97,  116, 101, 0,   10,  8,   15,  15,  18,  6,   0,   130, 97,  103, 117, 101, 0,   8,   12,  6,   8,   21,  0,   131, 101, 105, 118, 101, 0,   12,  8,   11, 6,   0,   130, 105, 101, 102, 0,   17,  0,   76,  3,   2,  21,  16,  2,  0,   15,  8,   12,  6,   0,   133, 101, 105, 108, 105, 110, 103, 0,   12,  23,  22,  0,   131, 114, 105, 110, 103, 0,   70,  33,  2,   23,  44, 2,   0,   12,  23,  26,  22,  0,   131, 105,
                                                                   116, 99,  104, 0,   10, 12, 8,   11, 0,   129, 104, 116, 0,   72,  69, 2,   10,  80, 2,   18,  89,  2,   21,  156, 2,  24,  167, 2,   0,   22,  18,  18,  11,  6,   0,   131, 115, 101, 110, 0,   12,  21,  23, 22,  0,   129, 110, 103, 0,   12,  0,   86,  98, 2,   23, 124, 2,   0,   68,  105, 2,   22,  114, 2,   0,   12, 15,  0,   131, 105, 115, 111, 110, 0,   4,   6,   6,   18,  0,   131, 105, 111, 110, 0,   76,  131, 2,   22, 146, 2,   0,  23,  12,  19,  8,   21,  0,   134, 101, 116, 105, 116, 105, 111, 110, 0,   18,  19,  0,   131, 105, 116, 105, 111, 110, 0,   23,  24,  8,   21,  0,   131, 116, 117, 114, 110, 0,   85,  174, 2,   23, 183, 2,   0,   23,  8,   21,  0,   130, 117, 114, 110, 0,  8,   21,  0,  128, 114, 110, 0,   7,   8,   24,  22,  19,  0,   131, 101, 117, 100, 111, 0,   24,  18,  18,  15,  0,   129, 107, 117, 112, 0,   72,  219, 2,  18,  3,   3,   0,   76,  229, 2,   15,  238,
                                                                   2,   17,  248, 2,   0,  11, 23,  44, 0,   130, 101, 105, 114, 0,   23, 12,  9,   0,  131, 108, 116, 101, 114, 0,   23, 22,  12,  15,  0,   130, 101, 110, 101, 114, 0,   23,  4,   21,  8,   23,  17,  12,  0,  135, 116, 101, 114, 97,  116, 111, 114, 0,   72, 30,  3,  17,  38,  3,   24,  51,  3,   0,   15,  4,   9,   0,  129, 115, 101, 0,   4,   12,  23,  17,  18,  6,   0,   131, 97,  105, 110, 115, 0,   22,  17,  8,   6,   17, 18,  6,   0,  133, 115, 101, 110, 115, 117, 115, 0,   74,  86,  3,   11,  96,  3,   15,  118, 3,   17,  129, 3,   22,  218, 3,   24,  232, 3,   0,   11,  24,  4,   6,   0,   130, 103, 104, 116, 0,   71,  103, 3,  10,  110, 3,   0,   12,  26,  0,   129, 116, 104, 0,   17, 8,   15,  0,  129, 116, 104, 0,   22,  24,  8,   21,  0,   131, 115, 117, 108, 116, 0,   68,  139, 3,   8,   150, 3,   22,  210, 3,   0,   21,  4,   19,  19, 4,   0,   130, 101, 110, 116, 0,   85,  157,
                                                                   3,   25,  200, 3,   0,  68, 164, 3,  21,  175, 3,   0,   19,  4,   0,  132, 112, 97, 114, 101, 110, 116, 0,   4,   19, 0,   68,  185, 3,   19,  193, 3,   0,   133, 112, 97,  114, 101, 110, 116, 0,   4,   0,  131, 101, 110, 116, 0,   8,   15,  8,   21,  0,  130, 97, 110, 116, 0,   18,  6,   0,   130, 110, 115, 116, 0,  12,  9,   8,   17,  4,   16,  0,   132, 105, 102, 101, 115, 116, 0,   83,  239, 3,   23,  6,   4,   0,   87, 246, 3,   24, 254, 3,   0,   17,  12,  0,   131, 112, 117, 116, 0,   18,  0,   130, 116, 112, 117, 116, 0,   19,  24,  18,  0,   131, 116, 112, 117, 116, 0,   70,  29,  4,   8,   41,  4,   11,  51,  4,   21,  69, 4,   0,   8,   24,  20,  8,   21,  9,   0,   129, 110, 99, 121, 0,   23, 9,   4,   22,  0,   130, 101, 116, 121, 0,   6,   21,  4,   21,  12,  8,   11,  0,   135, 105, 101, 114, 97,  114, 99,  104, 121, 0,   4,   5,  12,  15,  0,   130, 114, 97,  114, 121, 0};
+#endif
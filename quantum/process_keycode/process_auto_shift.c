@@ -17,6 +17,7 @@
 #include "process_auto_shift.h"
 #include "quantum.h"
 #include "action_util.h"
+#include "feature_timer.h"
 #include "timer.h"
 #include "keycodes.h"
 
@@ -223,6 +224,7 @@ static bool autoshift_press(uint16_t keycode, uint16_t now, keyrecord_t *record)
     autoshift_lastkey           = keycode;
     autoshift_time              = now;
     autoshift_flags.in_progress = true;
+    feature_timer_schedule(FEATURE_TIMER_AUTO_SHIFT, 0);
 
 #if !defined(NO_ACTION_ONESHOT) && !defined(NO_ACTION_TAPPING)
     clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
@@ -281,6 +283,7 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
 #endif
         // clang-format on
 #if TAP_CODE_DELAY > 0
+        flush_keyboard_report();
         wait_ms(TAP_CODE_DELAY);
 #endif
 
@@ -308,15 +311,18 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
  */
 void autoshift_matrix_scan(void) {
     if (autoshift_flags.in_progress) {
-        const uint16_t now = timer_read();
-        if (TIMER_DIFF_16(now, autoshift_time) >=
+        const uint16_t now     = timer_read();
+        const uint16_t elapsed = TIMER_DIFF_16(now, autoshift_time);
+        const uint16_t timeout =
 #ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
-            get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord)
+            get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord);
 #else
-            autoshift_timeout
+            autoshift_timeout;
 #endif
-        ) {
+        if (elapsed >= timeout) {
             autoshift_end(autoshift_lastkey, now, true, &autoshift_lastrecord);
+        } else {
+            feature_timer_schedule(FEATURE_TIMER_AUTO_SHIFT, timeout - elapsed);
         }
     }
 }
@@ -361,6 +367,7 @@ __attribute__((weak)) uint16_t get_autoshift_timeout(uint16_t keycode, keyrecord
 
 void set_autoshift_timeout(uint16_t timeout) {
     autoshift_timeout = timeout;
+    feature_timer_schedule(FEATURE_TIMER_AUTO_SHIFT, 0);
 }
 
 bool process_auto_shift(uint16_t keycode, keyrecord_t *record) {
@@ -497,6 +504,7 @@ void retroshift_poll_time(keyevent_t *event) {
 void retroshift_swap_times(void) {
     if (autoshift_flags.in_progress) {
         autoshift_time = last_retroshift_time;
+        feature_timer_schedule(FEATURE_TIMER_AUTO_SHIFT, 0);
     }
 }
 #endif
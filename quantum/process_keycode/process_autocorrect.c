@@ -12,7 +12,17 @@
 #include "send_string.h"
 #include "action_util.h"
 
-#if __has_include("autocorrect_data.h")
+#ifdef AUTOCORRECT_EXTERNAL_FLASH
+#    ifdef __AVR__
+#        error "AUTOCORRECT_EXTERNAL_FLASH is not supported on AVR"
+#    endif
+#    include "flash_spi.h"
+#    include "debug.h"
+#    include "util.h"
+#    ifndef AUTOCORRECT_AUTOMATON
+#        define AUTOCORRECT_AUTOMATON
+#    endif
+#elif __has_include("autocorrect_data.h")
 #    include "autocorrect_data.h"
 #else
 #    pragma message "Autocorrect is using the default library."
@@ -22,6 +32,34 @@
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
+#if defined(AUTOCORRECT_EXTERNAL_FLASH)
+#    if (AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGE_SIZE & (AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGE_SIZE - 1)) != 0 || AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGE_SIZE < 8 || AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGE_SIZE > 256
+#        error "AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGE_SIZE must be a power of two between 8 and 256"
+#    endif
+#    if AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGES < 1 || AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGES > 255
+#        error "AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGES must be between 1 and 255"
+#    endif
+// States are the byte offsets of their records in the image, the root follows the header
+typedef uint32_t autocorrect_state_t;
+#    define AUTOCORRECT_FLASH_MAGIC "QACF"
+#    define AUTOCORRECT_FLASH_VERSION 1
+#    define AUTOCORRECT_FLASH_MATCH 0x80
+#    define AUTOCORRECT_AUTOMATON_ROOT 16
+// Stands for the word boundary state, which is only known once the header of the image is read
+#    define AUTOCORRECT_AUTOMATON_BOUNDARY 0
+#elif defined(AUTOCORRECT_AUTOMATON)
+#    ifndef AUTOCORRECT_AUTOMATON_STATES
+#        error "autocorrect_data.h has no automaton, regenerate it with qmk generate-autocorrect-data"
+#    endif
+typedef uint16_t autocorrect_state_t;
+#    define AUTOCORRECT_AUTOMATON_ROOT 0
+#endif
+
+#ifdef AUTOCORRECT_AUTOMATON
+// Automaton state reached after each character of typo_buffer, so that backspace restores the previous one
+static autocorrect_state_t typo_states[AUTOCORRECT_MAX_LENGTH] = {AUTOCORRECT_AUTOMATON_BOUNDARY};
+#endif
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -188,6 +226,303 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+/**
+ * @brief Applies the correction of the typo at the end of the buffer
+ *
+ * @param keycode Keycode which completed the typo
+ * @param record keyrecord_t structure
+ * @param code backspace count of the correction, ORed with 128
+ * @param changes pointer to PROGMEM string to replace mistyped seletion with
+ * @return true Continue processing keycodes, and send to host
+ * @return false Stop processing keycodes, and don't send to host
+ */
+static bool autocorrect_typo_found(uint16_t keycode, keyrecord_t *record, uint8_t code, const char *changes) {
+    const uint8_t backspaces = (code & 63) + !record->event.pressed;
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
+        }
+
+        ++typo_len;
+    }
+
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
+
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
+    }
+
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
+        }
+        send_string_P(changes);
+    }
+
+    if (keycode == KC_SPC) {
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_size = 1;
+#ifdef AUTOCORRECT_AUTOMATON
+        typo_states[0] = AUTOCORRECT_AUTOMATON_BOUNDARY;
+#endif
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
+    }
+}
+
+#if defined(AUTOCORRECT_EXTERNAL_FLASH)
+typedef struct {
+    uint32_t address; // offset of the page in the image, UINT32_MAX when empty
+    uint16_t used;    // value of flash_cache_clock when the page was last read
+    uint8_t  data[AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGE_SIZE];
+} autocorrect_flash_page_t;
+
+static autocorrect_flash_page_t flash_cache[AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGES];
+static uint16_t                 flash_cache_clock;
+static int8_t                   flash_image_status; // 0 until the header is read, then 1 if the image is usable, -1 otherwise
+static autocorrect_state_t      flash_boundary;
+
+/**
+ * @brief Reads from the image in external flash through the page cache,
+ *        replacing the least recently used page on a miss
+ *
+ * @param offset offset in the image
+ * @param data buffer to read into
+ * @param size number of bytes to read
+ * @return true if the data was read
+ */
+static bool autocorrect_flash_read(uint32_t offset, uint8_t *data, uint8_t size) {
+    while (size > 0) {
+        uint32_t                  address = offset & ~(uint32_t)(AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGE_SIZE - 1);
+        autocorrect_flash_page_t *page    = &flash_cache[0];
+        for (uint8_t i = 0; i < AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGES; ++i) {
+            if (flash_cache[i].address == address) {
+                page = &flash_cache[i];
+                break;
+            }
+            if ((uint16_t)(flash_cache_clock - flash_cache[i].used) > (uint16_t)(flash_cache_clock - page->used)) {
+                page = &flash_cache[i];
+            }
+        }
+        if (page->address != address) {
+            if (flash_read_block(AUTOCORRECT_EXTERNAL_FLASH_ADDRESS + address, page->data, AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGE_SIZE) != FLASH_STATUS_SUCCESS) {
+                page->address = UINT32_MAX;
+                return false;
+            }
+            page->address = address;
+        }
+        page->used = ++flash_cache_clock;
+
+        uint8_t start = offset - address;
+        uint8_t count = MIN(size, AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGE_SIZE - start);
+        memcpy(data, page->data + start, count);
+        data += count;
+        offset += count;
+        size -= count;
+    }
+    return true;
+}
+
+static uint32_t autocorrect_flash_u24(const uint8_t *data) {
+    return data[0] | (uint32_t)data[1] << 8 | (uint32_t)data[2] << 16;
+}
+
+/**
+ * @brief Checks the header of the image in external flash, the first time it is needed
+ *
+ * @return true if the image can be used
+ */
+static bool autocorrect_flash_load(void) {
+    if (flash_image_status == 0) {
+        uint8_t header[AUTOCORRECT_AUTOMATON_ROOT];
+
+        flash_init();
+        for (uint8_t i = 0; i < AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGES; ++i) {
+            flash_cache[i].address = UINT32_MAX;
+        }
+
+        flash_image_status = -1;
+        if (!autocorrect_flash_read(0, header, sizeof(header))) {
+            dprintf("autocorrect: failed to read external flash\n");
+        } else if (memcmp(header, AUTOCORRECT_FLASH_MAGIC, 4) != 0 || header[4] != AUTOCORRECT_FLASH_VERSION) {
+            dprintf("autocorrect: no dictionary in external flash\n");
+        } else if (header[6] > AUTOCORRECT_MAX_LENGTH) {
+            dprintf("autocorrect: typos of %u characters exceed AUTOCORRECT_MAX_LENGTH\n", header[6]);
+        } else {
+            flash_boundary     = autocorrect_flash_u24(header + 12);
+            flash_image_status = 1;
+        }
+    }
+    return flash_image_status > 0;
+}
+
+/**
+ * @brief Reads the dictionary image from external flash again on the next
+ *        keystroke, once it has been rewritten
+ *
+ */
+void autocorrect_external_flash_reload(void) {
+    flash_image_status = 0;
+    typo_buffer_size   = 0;
+}
+
+/**
+ * @brief Advances the automaton by one character, following failure links
+ *        until a state with a transition for `keycode` or the root is found
+ *
+ * @param state state reached before `keycode`
+ * @param keycode character to append, KC_A-KC_Z, KC_QUOT or KC_SPC
+ * @return state reached after `keycode`
+ */
+static autocorrect_state_t autocorrect_automaton_step(autocorrect_state_t state, uint8_t keycode) {
+    if (!autocorrect_flash_load()) {
+        return AUTOCORRECT_AUTOMATON_ROOT;
+    }
+    if (state == AUTOCORRECT_AUTOMATON_BOUNDARY) {
+        state = flash_boundary;
+    }
+
+    // Each failure link leads to a shorter suffix, which bounds the reads of a corrupted image too.
+    for (uint8_t depth = 0; depth <= AUTOCORRECT_MAX_LENGTH; ++depth) {
+        uint8_t record[4];
+        if (!autocorrect_flash_read(state, record, sizeof(record))) {
+            break;
+        }
+        if (record[0] != AUTOCORRECT_FLASH_MATCH) {
+            // Transitions are sorted by keycode.
+            for (uint8_t i = 0; i < record[0]; ++i) {
+                uint8_t edge[4];
+                if (!autocorrect_flash_read(state + 4 + 4 * i, edge, sizeof(edge)) || edge[0] > keycode) {
+                    break;
+                }
+                if (edge[0] == keycode) {
+                    return autocorrect_flash_u24(edge + 1);
+                }
+            }
+        }
+        if (state == AUTOCORRECT_AUTOMATON_ROOT) {
+            break;
+        }
+        state = autocorrect_flash_u24(record + 1);
+    }
+    return AUTOCORRECT_AUTOMATON_ROOT;
+}
+
+/**
+ * @brief Looks up the correction of the typo completed by `state`
+ *
+ * @param state state of the automaton
+ * @param code set to the backspace count of the correction, ORed with 128
+ * @param changes set to the replacement string
+ * @return true if `state` completes a typo
+ */
+static bool autocorrect_automaton_match(autocorrect_state_t state, uint8_t *code, const char **changes) {
+    static char correction[AUTOCORRECT_MAX_LENGTH + 10];
+    uint8_t     record[5];
+
+    // The header pages stay cached after a rejected image, so check its status before reading states.
+    if (flash_image_status <= 0 || state == AUTOCORRECT_AUTOMATON_BOUNDARY || !autocorrect_flash_read(state, record, sizeof(record)) || record[0] != AUTOCORRECT_FLASH_MATCH) {
+        return false;
+    }
+    state += sizeof(record);
+    for (uint8_t i = 0; i < sizeof(correction); ++i) {
+        if (i == sizeof(correction) - 1 || !autocorrect_flash_read(state + i, (uint8_t *)correction + i, 1)) {
+            correction[i] = 0;
+        }
+        if (!correction[i]) {
+            break;
+        }
+    }
+    *code    = record[4];
+    *changes = correction;
+    return true;
+}
+#elif defined(AUTOCORRECT_AUTOMATON)
+/**
+ * @brief Advances the automaton by one character, following failure links
+ *        until a state with a transition for `keycode` or the root is found
+ *
+ * @param state state reached before `keycode`
+ * @param keycode character to append, KC_A-KC_Z, KC_QUOT or KC_SPC
+ * @return state reached after `keycode`
+ */
+static autocorrect_state_t autocorrect_automaton_step(autocorrect_state_t state, uint8_t keycode) {
+    for (;;) {
+        // States completing a typo come last, and have no transitions of their own.
+        if (state < AUTOCORRECT_AUTOMATON_FIRST_MATCH) {
+            uint16_t edge = pgm_read_word(autocorrect_automaton_edges + state);
+            uint16_t last = pgm_read_word(autocorrect_automaton_edges + state + 1);
+            // Transitions are sorted by keycode.
+            for (; edge < last; ++edge) {
+                uint8_t key = pgm_read_byte(autocorrect_automaton_keys + edge);
+                if (key == keycode) {
+                    return pgm_read_word(autocorrect_automaton_targets + edge);
+                }
+                if (key > keycode) {
+                    break;
+                }
+            }
+        }
+        if (state == AUTOCORRECT_AUTOMATON_ROOT) {
+            return AUTOCORRECT_AUTOMATON_ROOT;
+        }
+        state = pgm_read_word(autocorrect_automaton_fail + state);
+    }
+}
+
+/**
+ * @brief Looks up the correction of the typo completed by `state`
+ *
+ * @param state state of the automaton
+ * @param code set to the backspace count of the correction, ORed with 128
+ * @param changes set to the PROGMEM replacement string
+ * @return true if `state` completes a typo
+ */
+static bool autocorrect_automaton_match(autocorrect_state_t state, uint8_t *code, const char **changes) {
+    if (state < AUTOCORRECT_AUTOMATON_FIRST_MATCH) {
+        return false;
+    }
+    const uint8_t *correction = autocorrect_automaton_corrections + pgm_read_word(autocorrect_automaton_matches + state - AUTOCORRECT_AUTOMATON_FIRST_MATCH);
+
+    *code    = pgm_read_byte(correction);
+    *changes = (const char *)(correction + 1);
+    return true;
+}
+#endif
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -268,9 +603,26 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     // Rotate oldest character if buffer is full.
     if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
         memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
+#ifdef AUTOCORRECT_AUTOMATON
+        memmove(typo_states, typo_states + 1, (AUTOCORRECT_MAX_LENGTH - 1) * sizeof(typo_states[0]));
+#endif
         typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
     }
 
+#ifdef AUTOCORRECT_AUTOMATON
+    // A single transition of the automaton tracks every typo the buffer could be in the middle of.
+    autocorrect_state_t state = autocorrect_automaton_step(typo_buffer_size ? typo_states[typo_buffer_size - 1] : AUTOCORRECT_AUTOMATON_ROOT, keycode);
+
+    typo_states[typo_buffer_size]   = state;
+    typo_buffer[typo_buffer_size++] = keycode;
+
+    uint8_t     code;
+    const char *changes;
+    if (autocorrect_automaton_match(state, &code, &changes)) { // A typo was found! Apply autocorrect.
+        return autocorrect_typo_found(keycode, record, code, changes);
+    }
+    return true;
+#else
     // Append `keycode` to buffer.
     typo_buffer[typo_buffer_size++] = keycode;
     // Return if buffer is smaller than the shortest word.
@@ -307,69 +659,9 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         code = pgm_read_byte(autocorrect_data + state);
 
         if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
-
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
-
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
-
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+            return autocorrect_typo_found(keycode, record, code, (const char *)(autocorrect_data + state + 1));
         }
     }
     return true;
+#endif
 }
@@ -10,6 +10,23 @@
 #include <stdbool.h>
 #include "action.h"
 
+#ifdef AUTOCORRECT_EXTERNAL_FLASH
+// Offset of the dictionary image in external flash
+#    ifndef AUTOCORRECT_EXTERNAL_FLASH_ADDRESS
+#        define AUTOCORRECT_EXTERNAL_FLASH_ADDRESS 0
+#    endif
+// Longest typo supported, the dictionary is not known at compile time
+#    ifndef AUTOCORRECT_MAX_LENGTH
+#        define AUTOCORRECT_MAX_LENGTH 32
+#    endif
+#    ifndef AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGES
+#        define AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGES 8
+#    endif
+#    ifndef AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGE_SIZE
+#        define AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGE_SIZE 64
+#    endif
+#endif
+
 bool process_autocorrect(uint16_t keycode, keyrecord_t *record);
 bool process_autocorrect_user(uint16_t *keycode, keyrecord_t *record, uint8_t *typo_buffer_size, uint8_t *mods);
 bool process_autocorrect_default_handler(uint16_t *keycode, keyrecord_t *record, uint8_t *typo_buffer_size, uint8_t *mods);
@@ -19,3 +36,7 @@ bool autocorrect_is_enabled(void);
 void autocorrect_enable(void);
 void autocorrect_disable(void);
 void autocorrect_toggle(void);
+
+#ifdef AUTOCORRECT_EXTERNAL_FLASH
+void autocorrect_external_flash_reload(void);
+#endif
@@ -16,6 +16,7 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
@@ -26,6 +27,8 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#include "feature_timer.h"
+#include "debug.h"
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -76,6 +79,8 @@ static uint16_t timer = 0;
 #endif
 static bool     b_combo_enable = true; // defaults to enabled
 static uint16_t longest_term   = 0;
+// set once a key event reached a combo, until clear_combos() resets their state
+static bool combo_state_dirty = false;
 
 typedef struct {
     keyrecord_t record;
@@ -194,6 +199,10 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+    if (!combo_state_dirty) {
+        return;
+    }
+    combo_state_dirty = false;
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
@@ -248,6 +257,7 @@ static inline void dump_key_buffer(void) {
         // only delay once and for a non-tapping key
         if (!delay_done && !is_tap_record(record)) {
             delay_done = true;
+            flush_keyboard_report();
             wait_ms(TAP_CODE_DELAY);
         }
 #endif
@@ -256,7 +266,6 @@ static inline void dump_key_buffer(void) {
     key_buffer_next = key_buffer_size = 0;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -414,15 +423,8 @@ static bool keys_pressed_in_order(uint16_t combo_index, combo_t *combo, uint16_t
 }
 #endif
 
-static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
-    uint8_t  key_count = 0;
-    uint16_t key_index = -1;
-    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
-
-    /* Continue processing if key isn't part of current combo. */
-    if (-1 == (int16_t)key_index) {
-        return false;
-    }
+static bool process_single_combo_key(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index, uint16_t key_index, uint8_t key_count) {
+    combo_state_dirty = true;
 
     bool key_is_part_of_combo = (!COMBO_DISABLED(combo) && is_combo_enabled()
 #if defined(COMBO_MUST_PRESS_IN_ORDER) || defined(COMBO_MUST_PRESS_IN_ORDER_PER_COMBO)
@@ -534,9 +536,123 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
     return key_is_part_of_combo;
 }
 
+static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
+    uint8_t  key_count = 0;
+    uint16_t key_index = -1;
+    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
+
+    /* Continue processing if key isn't part of current combo. */
+    if (-1 == (int16_t)key_index) {
+        return false;
+    }
+
+    return process_single_combo_key(combo, keycode, record, combo_index, key_index, key_count);
+}
+
+#ifdef COMBO_KEY_INDEX
+/* Reverse index from keycodes to the combos containing them, so that a key
+ * event only visits those combos rather than every combo. Entries are grouped
+ * in buckets by a hash of their keycode, and sorted by combo index within a
+ * bucket so that combos are processed in the same order as a linear scan. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+    uint8_t  key_index;
+    uint8_t  key_count;
+} combo_key_index_entry_t;
+
+#    if COMBO_KEY_INDEX_BUCKETS > 255
+#        error "COMBO_KEY_INDEX_BUCKETS must not exceed 255"
+#    endif
+
+enum { COMBO_KEY_INDEX_STALE, COMBO_KEY_INDEX_READY, COMBO_KEY_INDEX_OVERFLOW };
+
+static combo_key_index_entry_t combo_key_index[COMBO_KEY_INDEX_SIZE];
+// combo_key_index_start[b] .. combo_key_index_start[b + 1] are the entries of bucket b
+static uint16_t combo_key_index_start[COMBO_KEY_INDEX_BUCKETS + 1];
+static uint8_t  combo_key_index_status = COMBO_KEY_INDEX_STALE;
+
+static inline uint8_t combo_key_index_bucket(uint16_t keycode) {
+    return (keycode ^ (keycode >> 8)) % COMBO_KEY_INDEX_BUCKETS;
+}
+
+static uint8_t combo_key_count(const uint16_t *keys) {
+    uint8_t key_count = 0;
+    while (pgm_read_word(&keys[key_count]) != COMBO_END) {
+        key_count++;
+    }
+    return key_count;
+}
+
+/* A keycode listed more than once in a combo is matched at its last
+ * occurrence, as _find_key_index_and_count() does. */
+static bool combo_key_is_last_occurrence(const uint16_t *keys, uint8_t key_index, uint8_t key_count) {
+    uint16_t keycode = pgm_read_word(&keys[key_index]);
+    for (uint8_t i = key_index + 1; i < key_count; i++) {
+        if (pgm_read_word(&keys[i]) == keycode) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void combo_key_index_build(void) {
+    uint16_t fill[COMBO_KEY_INDEX_BUCKETS];
+    uint16_t entries = 0;
+
+    memset(combo_key_index_start, 0, sizeof(combo_key_index_start));
+
+    // Count the entries of every bucket
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys      = combo_get(idx)->keys;
+        uint8_t         key_count = combo_key_count(keys);
+        for (uint8_t key_index = 0; key_index < key_count; key_index++) {
+            if (combo_key_is_last_occurrence(keys, key_index, key_count)) {
+                combo_key_index_start[combo_key_index_bucket(pgm_read_word(&keys[key_index])) + 1]++;
+                entries++;
+            }
+        }
+    }
+
+    if (entries > COMBO_KEY_INDEX_SIZE) {
+        dprintf("combo: %u keys do not fit in COMBO_KEY_INDEX_SIZE, scanning all combos\n", entries);
+        combo_key_index_status = COMBO_KEY_INDEX_OVERFLOW;
+        return;
+    }
+
+    for (uint8_t bucket = 0; bucket < COMBO_KEY_INDEX_BUCKETS; bucket++) {
+        combo_key_index_start[bucket + 1] += combo_key_index_start[bucket];
+        fill[bucket] = combo_key_index_start[bucket];
+    }
+
+    // Place the entries, visiting combos in order keeps every bucket sorted
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys      = combo_get(idx)->keys;
+        uint8_t         key_count = combo_key_count(keys);
+        for (uint8_t key_index = 0; key_index < key_count; key_index++) {
+            if (combo_key_is_last_occurrence(keys, key_index, key_count)) {
+                uint16_t keycode = pgm_read_word(&keys[key_index]);
+
+                combo_key_index[fill[combo_key_index_bucket(keycode)]++] = (combo_key_index_entry_t){
+                    .keycode     = keycode,
+                    .combo_index = idx,
+                    .key_index   = key_index,
+                    .key_count   = key_count,
+                };
+            }
+        }
+    }
+
+    combo_key_index_status = COMBO_KEY_INDEX_READY;
+}
+
+void combo_key_index_invalidate(void) {
+    combo_key_index_status = COMBO_KEY_INDEX_STALE;
+}
+#endif
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    bool is_combo_key          = false;
-    bool no_combo_keys_pressed = true;
+    bool is_combo_key = false;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -564,10 +680,25 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEY_INDEX
+    if (combo_key_index_status == COMBO_KEY_INDEX_STALE) {
+        combo_key_index_build();
+    }
+
+    if (combo_key_index_status == COMBO_KEY_INDEX_READY) {
+        uint8_t bucket = combo_key_index_bucket(keycode);
+        for (uint16_t i = combo_key_index_start[bucket]; i < combo_key_index_start[bucket + 1]; i++) {
+            const combo_key_index_entry_t *entry = &combo_key_index[i];
+            if (entry->keycode == keycode) {
+                is_combo_key |= process_single_combo_key(combo_get(entry->combo_index), keycode, record, entry->combo_index, entry->key_index, entry->key_count);
+            }
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -602,6 +733,12 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
             clear_combos();
         }
     }
+
+#ifndef COMBO_NO_TIMER
+    if (timer) {
+        feature_timer_schedule(FEATURE_TIMER_COMBO, 0);
+    }
+#endif
     return !is_combo_key;
 }
 
@@ -611,16 +748,24 @@ void combo_task(void) {
     }
 
 #ifndef COMBO_NO_TIMER
-    if (timer && timer_elapsed(timer) > longest_term) {
-        if (combo_buffer_read != combo_buffer_write) {
-            apply_combos();
-            longest_term = 0;
-            timer        = 0;
-        } else {
-            dump_key_buffer();
-            timer = 0;
-            clear_combos();
-        }
+    if (!timer) {
+        return;
+    }
+
+    uint16_t elapsed = timer_elapsed(timer);
+    if (elapsed <= longest_term) {
+        feature_timer_schedule(FEATURE_TIMER_COMBO, longest_term - elapsed + 1);
+        return;
+    }
+
+    if (combo_buffer_read != combo_buffer_write) {
+        apply_combos();
+        longest_term = 0;
+        timer        = 0;
+    } else {
+        dump_key_buffer();
+        timer = 0;
+        clear_combos();
     }
 #endif
 }
@@ -39,6 +39,15 @@
 #    define COMBO_BUFFER_LENGTH 4
 #endif
 
+#ifdef COMBO_KEY_INDEX
+#    ifndef COMBO_KEY_INDEX_SIZE
+#        define COMBO_KEY_INDEX_SIZE 128
+#    endif
+#    ifndef COMBO_KEY_INDEX_BUCKETS
+#        define COMBO_KEY_INDEX_BUCKETS 32
+#    endif
+#endif
+
 typedef struct combo_t {
     const uint16_t *keys;
     uint16_t        keycode;
@@ -81,3 +90,8 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_KEY_INDEX
+// Rebuilds the keycode to combo index on the next key event, to be called if combo_get() starts returning different combos
+void combo_key_index_invalidate(void);
+#endif
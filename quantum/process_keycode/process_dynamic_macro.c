@@ -100,6 +100,7 @@ void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_
         process_record(macro_buffer);
         macro_buffer += direction;
 #ifdef DYNAMIC_MACRO_DELAY
+        flush_keyboard_report();
         wait_ms(DYNAMIC_MACRO_DELAY);
 #endif
     }
@@ -15,12 +15,14 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
 #include "process_key_override.h"
 #include "report.h"
 #include "timer.h"
 #include "debug.h"
 #include "wait.h"
 #include "action_util.h"
+#include "feature_timer.h"
 #include "quantum.h"
 #include "quantum_keycodes.h"
 
@@ -157,6 +159,7 @@ static void schedule_deferred_register(const uint16_t keycode) {
         defer_delay          = 50; // 50ms
     }
     deferred_register = keycode;
+    feature_timer_schedule(FEATURE_TIMER_KEY_OVERRIDE, 0);
 }
 
 const key_override_t *clear_active_override(const bool allow_reregister) {
@@ -245,152 +248,265 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
-static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
-    if (key_overrides == NULL) {
-        return true;
+/** Tries activating a single key override. Returns true if it activated, in which case `send_key_action` is set to whether the key action for `keycode` should be sent */
+static bool try_activating_single_override(const key_override_t *const override, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *send_key_action) {
+    // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
+    if (active_mods == 0 && override->trigger_mods != 0) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
     }
 
-    for (uint8_t i = 0;; i++) {
-        const key_override_t *const override = key_overrides[i];
+    // Check layer
+    if ((override->layers & (1 << layer)) == 0) {
+        key_override_printf("Not activating override: Not set to activate on pressed layer\n");
+        return false;
+    }
 
-        // End of array
-        if (override == NULL) {
-            break;
-        }
+    // Check allowed activation events
+    if (!check_activation_event(override, key_down, is_mod)) {
+        key_override_printf("Not activating override: Activation event not allowed\n");
+        return false;
+    }
 
-        // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
-        if (active_mods == 0 && override->trigger_mods != 0) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    const bool is_trigger = override->trigger == keycode;
 
-        // Check layer
-        if ((override->layers & (1 << layer)) == 0) {
-            key_override_printf("Not activating override: Not set to activate on pressed layer\n");
-            continue;
-        }
+    // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
+    if (is_trigger && !key_down) {
+        key_override_printf("Not activating override: Trigger lifted\n");
+        return false;
+    }
 
-        // Check allowed activation events
-        if (!check_activation_event(override, key_down, is_mod)) {
-            key_override_printf("Not activating override: Activation event not allowed\n");
-            continue;
-        }
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
 
-        const bool is_trigger = override->trigger == keycode;
+    // Check if aleady active
+    if (override == active_override) {
+        key_override_printf("Not activating override: Alerady actived\n");
+        return false;
+    }
 
-        // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
-        if (is_trigger && !key_down) {
-            key_override_printf("Not activating override: Trigger lifted\n");
-            continue;
-        }
+    // Check if enabled
+    if (override->enabled != NULL && !((*(override->enabled) & 1))) {
+        key_override_printf("Not activating override: Not enabled\n");
+        return false;
+    }
 
-        // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
-        const bool no_trigger = override->trigger == KC_NO;
+    // Check mods precisely
+    if (!key_override_matches_active_modifiers(override, active_mods)) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
 
-        // Check if aleady active
-        if (override == active_override) {
-            key_override_printf("Not activating override: Alerady actived\n");
-            continue;
-        }
+    // Check if trigger key is down.
+    const bool trigger_down = is_trigger && key_down;
 
-        // Check if enabled
-        if (override->enabled != NULL && !((*(override->enabled) & 1))) {
-            key_override_printf("Not activating override: Not enabled\n");
-            continue;
-        }
+    // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
+    // If no trigger key is required, yes.
+    // If the trigger was just pressed, yes.
+    // If the last non-mod key that was pressed down is the trigger key, yes.
+    bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
 
-        // Check mods precisely
-        if (!key_override_matches_active_modifiers(override, active_mods)) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    if (!should_activate) {
+        key_override_printf("Not activating override. Trigger not down\n");
+        return false;
+    }
 
-        // Check if trigger key is down.
-        const bool trigger_down = is_trigger && key_down;
+    key_override_printf("Activating override\n");
 
-        // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
-        // If no trigger key is required, yes.
-        // If the trigger was just pressed, yes.
-        // If the last non-mod key that was pressed down is the trigger key, yes.
-        bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+    clear_active_override(false);
 
-        if (!should_activate) {
-            key_override_printf("Not activating override. Trigger not down\n");
-            continue;
-        }
+#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
+    // Send a dummy keycode before unregistering the modifier(s)
+    // so that suppressing the modifier(s) doesn't falsely get interpreted
+    // by the host OS as a tap of a modifier key.
+    // For example, unintended activations of the start menu on Windows when
+    // using a GUI+<kc> key override with suppressed mods.
+    neutralize_flashing_modifiers(active_mods);
+#endif
 
-        key_override_printf("Activating override\n");
+    active_override                 = override;
+    active_override_trigger_is_down = true;
 
-        clear_active_override(false);
+    set_suppressed_override_mods(override->suppressed_mods);
 
-#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
-        // Send a dummy keycode before unregistering the modifier(s)
-        // so that suppressing the modifier(s) doesn't falsely get interpreted
-        // by the host OS as a tap of a modifier key.
-        // For example, unintended activations of the start menu on Windows when
-        // using a GUI+<kc> key override with suppressed mods.
-        neutralize_flashing_modifiers(active_mods);
-#endif
+    if (!trigger_down && !no_trigger) {
+        // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
+        if (IS_BASIC_KEYCODE(override->trigger)) {
+            del_key(override->trigger);
+        } else {
+            unregister_code(override->trigger);
+        }
+    }
 
-        active_override                 = override;
-        active_override_trigger_is_down = true;
+    const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
 
-        set_suppressed_override_mods(override->suppressed_mods);
+    bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
+                                mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
 
-        if (!trigger_down && !no_trigger) {
-            // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
-            if (IS_BASIC_KEYCODE(override->trigger)) {
-                del_key(override->trigger);
+    // Try firing the custom handler
+    if (override->custom_action != NULL) {
+        register_replacement &= override->custom_action(true, override->context);
+    }
+
+    if (register_replacement) {
+        const uint8_t override_mods = extract_mod_bits(override->replacement);
+        set_weak_override_mods(override_mods);
+
+        // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
+        if (is_mod) {
+            key_override_printf("Deferring register replacement key\n");
+            schedule_deferred_register(mod_free_replacement);
+            send_keyboard_report();
+        } else {
+            if (IS_BASIC_KEYCODE(mod_free_replacement)) {
+                add_key(mod_free_replacement);
             } else {
-                unregister_code(override->trigger);
+                key_override_printf("NOT KEY 2\n");
+                send_keyboard_report();
+                // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
+                flush_keyboard_report();
+                wait_ms(10);
+                register_code(mod_free_replacement);
             }
         }
+    } else {
+        // If not registering the replacement key send keyboard report to update the unregistered keys.
+        send_keyboard_report();
+    }
 
-        const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+    // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
+    *send_key_action = !trigger_down;
+    return true;
+}
 
-        bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
-                                    mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+#ifdef KEY_OVERRIDE_INDEX
+/* Index from trigger keycodes to the key overrides they trigger, so that a key
+ * event only visits the overrides it could activate rather than every one.
+ * Overrides are grouped in buckets by a hash of their trigger, with overrides
+ * triggered by KC_NO in a bucket of their own, and sorted by their position
+ * in key_overrides within a bucket so that the first matching override still
+ * wins. */
+#    if KEY_OVERRIDE_INDEX_BUCKETS > 254
+#        error "KEY_OVERRIDE_INDEX_BUCKETS must not exceed 254"
+#    endif
+#    if KEY_OVERRIDE_INDEX_SIZE > 255
+#        error "KEY_OVERRIDE_INDEX_SIZE must not exceed 255"
+#    endif
+
+#    define KEY_OVERRIDE_INDEX_NO_TRIGGER KEY_OVERRIDE_INDEX_BUCKETS
+
+enum { KEY_OVERRIDE_INDEX_STALE, KEY_OVERRIDE_INDEX_READY, KEY_OVERRIDE_INDEX_OVERFLOW };
+
+static uint8_t key_override_index[KEY_OVERRIDE_INDEX_SIZE];
+// key_override_index_start[b] .. key_override_index_start[b + 1] are the overrides of bucket b
+static uint8_t                key_override_index_start[KEY_OVERRIDE_INDEX_BUCKETS + 2];
+static uint8_t                key_override_index_status = KEY_OVERRIDE_INDEX_STALE;
+static const key_override_t **key_override_index_source = NULL;
+
+static inline uint8_t key_override_index_bucket(uint16_t trigger) {
+    if (trigger == KC_NO) {
+        return KEY_OVERRIDE_INDEX_NO_TRIGGER;
+    }
+    return (trigger ^ (trigger >> 8)) % KEY_OVERRIDE_INDEX_BUCKETS;
+}
 
-        // Try firing the custom handler
-        if (override->custom_action != NULL) {
-            register_replacement &= override->custom_action(true, override->context);
-        }
+static void key_override_index_build(void) {
+    uint8_t  fill[KEY_OVERRIDE_INDEX_BUCKETS + 1];
+    uint16_t count = 0;
 
-        if (register_replacement) {
-            const uint8_t override_mods = extract_mod_bits(override->replacement);
-            set_weak_override_mods(override_mods);
+    key_override_index_source = key_overrides;
+    memset(key_override_index_start, 0, sizeof(key_override_index_start));
 
-            // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
-            if (is_mod) {
-                key_override_printf("Deferring register replacement key\n");
-                schedule_deferred_register(mod_free_replacement);
-                send_keyboard_report();
-            } else {
-                if (IS_BASIC_KEYCODE(mod_free_replacement)) {
-                    add_key(mod_free_replacement);
-                } else {
-                    key_override_printf("NOT KEY 2\n");
-                    send_keyboard_report();
-                    // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
-                    wait_ms(10);
-                    register_code(mod_free_replacement);
-                }
+    while (key_overrides[count] != NULL) {
+        count++;
+    }
+
+    if (count > KEY_OVERRIDE_INDEX_SIZE) {
+        dprintf("key override: %u overrides do not fit in KEY_OVERRIDE_INDEX_SIZE, scanning all overrides\n", count);
+        key_override_index_status = KEY_OVERRIDE_INDEX_OVERFLOW;
+        return;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        key_override_index_start[key_override_index_bucket(key_overrides[i]->trigger) + 1]++;
+    }
+    for (uint8_t bucket = 0; bucket <= KEY_OVERRIDE_INDEX_BUCKETS; bucket++) {
+        key_override_index_start[bucket + 1] += key_override_index_start[bucket];
+        fill[bucket] = key_override_index_start[bucket];
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        key_override_index[fill[key_override_index_bucket(key_overrides[i]->trigger)]++] = i;
+    }
+
+    key_override_index_status = KEY_OVERRIDE_INDEX_READY;
+}
+
+void key_override_index_invalidate(void) {
+    key_override_index_status = KEY_OVERRIDE_INDEX_STALE;
+}
+
+/** Tries the overrides of the given buckets, in the order of key_overrides. */
+static bool try_activating_indexed_overrides(const uint8_t *buckets, uint8_t bucket_count, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *send_key_action) {
+    uint8_t next[3];
+    for (uint8_t b = 0; b < bucket_count; b++) {
+        next[b] = key_override_index_start[buckets[b]];
+    }
+
+    while (true) {
+        // Merge the buckets, which are each sorted by position in key_overrides
+        uint8_t earliest = bucket_count;
+        for (uint8_t b = 0; b < bucket_count; b++) {
+            if (next[b] < key_override_index_start[buckets[b] + 1] && (earliest == bucket_count || key_override_index[next[b]] < key_override_index[next[earliest]])) {
+                earliest = b;
             }
-        } else {
-            // If not registering the replacement key send keyboard report to update the unregistered keys.
-            send_keyboard_report();
+        }
+        if (earliest == bucket_count) {
+            return false;
         }
 
-        *activated = true;
-
-        // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
-        return !trigger_down;
+        const uint8_t i = key_override_index[next[earliest]++];
+        if (try_activating_single_override(key_overrides[i], keycode, layer, key_down, is_mod, active_mods, send_key_action)) {
+            return true;
+        }
     }
+}
+#endif
+
+/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
+static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    bool send_key_action = true;
 
     *activated = false;
+    if (key_overrides == NULL) {
+        return true;
+    }
 
-    return true;
+#ifdef KEY_OVERRIDE_INDEX
+    if (key_override_index_status == KEY_OVERRIDE_INDEX_STALE || key_override_index_source != key_overrides) {
+        key_override_index_build();
+    }
+
+    if (key_override_index_status == KEY_OVERRIDE_INDEX_READY) {
+        // An override can only activate if its trigger is the key of the event, the last key pressed down, or KC_NO
+        uint8_t buckets[3]   = {KEY_OVERRIDE_INDEX_NO_TRIGGER, key_override_index_bucket(keycode)};
+        uint8_t bucket_count = 2;
+        if (last_key_down != KC_NO && key_override_index_bucket(last_key_down) != buckets[1]) {
+            buckets[bucket_count++] = key_override_index_bucket(last_key_down);
+        }
+
+        *activated = try_activating_indexed_overrides(buckets, bucket_count, keycode, layer, key_down, is_mod, active_mods, &send_key_action);
+        return send_key_action;
+    }
+#endif
+
+    for (uint8_t i = 0; key_overrides[i] != NULL; i++) {
+        if (try_activating_single_override(key_overrides[i], keycode, layer, key_down, is_mod, active_mods, &send_key_action)) {
+            *activated = true;
+            break;
+        }
+    }
+
+    return send_key_action;
 }
 
 void key_override_task(void) {
@@ -398,18 +514,22 @@ void key_override_task(void) {
         return;
     }
 
-    if (timer_elapsed32(defer_reference_time) >= defer_delay) {
-        key_override_printf("Registering deferred key\n");
-        register_code16(deferred_register);
-        deferred_register    = 0;
-        defer_reference_time = 0;
-        defer_delay          = 0;
+    uint32_t elapsed = timer_elapsed32(defer_reference_time);
+    if (elapsed < defer_delay) {
+        feature_timer_schedule(FEATURE_TIMER_KEY_OVERRIDE, defer_delay - elapsed);
+        return;
     }
+
+    key_override_printf("Registering deferred key\n");
+    register_code16(deferred_register);
+    deferred_register    = 0;
+    defer_reference_time = 0;
+    defer_delay          = 0;
 }
 
 bool process_key_override(const uint16_t keycode, const keyrecord_t *const record) {
 #ifdef BENCH_KEY_OVERRIDE
-    uint16_t start = timer_read();
+    uint32_t start = timer_read_hires();
 #endif
 
     const bool key_down = record->event.pressed;
@@ -522,9 +642,9 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
     }
 
 #ifdef BENCH_KEY_OVERRIDE
-    uint16_t elapsed = timer_elapsed(start);
+    uint32_t elapsed = timer_hires_to_us(timer_read_hires() - start);
 
-    dprintf("Processing key overrides took: %u ms\n", elapsed);
+    dprintf("Processing key overrides took: %lu us\n", (unsigned long)elapsed);
 #endif
 
     return send_key_action;
@@ -22,6 +22,15 @@
 #include "action.h"
 #include "action_layer.h"
 
+#ifdef KEY_OVERRIDE_INDEX
+#    ifndef KEY_OVERRIDE_INDEX_SIZE
+#        define KEY_OVERRIDE_INDEX_SIZE 128
+#    endif
+#    ifndef KEY_OVERRIDE_INDEX_BUCKETS
+#        define KEY_OVERRIDE_INDEX_BUCKETS 32
+#    endif
+#endif
+
 /**
  * Key overrides allow you to send a different key-modifier combination or perform a custom action when a certain modifier-key combination is pressed.
  *
@@ -90,6 +99,11 @@ typedef struct {
 /** Define this as a null-terminated array of pointers to key overrides. These key overrides will be used by qmk. */
 extern const key_override_t **key_overrides;
 
+#ifdef KEY_OVERRIDE_INDEX
+// Rebuilds the trigger keycode to key override index on the next key event, to be called if the contents of key_overrides change
+void key_override_index_invalidate(void);
+#endif
+
 /** Turns key overrides on */
 void key_override_on(void);
 
@@ -19,6 +19,7 @@
 #include "action_layer.h"
 #include "action_tapping.h"
 #include "action_util.h"
+#include "feature_timer.h"
 #include "timer.h"
 #include "wait.h"
 
@@ -44,6 +45,7 @@ void tap_dance_pair_reset(tap_dance_state_t *state, void *user_data) {
     tap_dance_pair_t *pair = (tap_dance_pair_t *)user_data;
 
     if (state->count == 1) {
+        flush_keyboard_report();
         wait_ms(TAP_CODE_DELAY);
         unregister_code16(pair->kc1);
     } else if (state->count == 2) {
@@ -74,6 +76,7 @@ void tap_dance_dual_role_reset(tap_dance_state_t *state, void *user_data) {
     tap_dance_dual_role_t *pair = (tap_dance_dual_role_t *)user_data;
 
     if (state->count == 1) {
+        flush_keyboard_report();
         wait_ms(TAP_CODE_DELAY);
         unregister_code16(pair->kc);
     }
@@ -161,6 +164,7 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
                 last_tap_time = timer_read();
                 process_tap_dance_action_on_each_tap(action);
                 active_td = action->state.finished ? 0 : keycode;
+                feature_timer_schedule(FEATURE_TIMER_TAP_DANCE, 0);
             } else {
                 process_tap_dance_action_on_each_release(action);
                 if (action->state.finished) {
@@ -180,7 +184,14 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 void tap_dance_task(void) {
     tap_dance_action_t *action;
 
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+    if (!active_td) return;
+
+    uint16_t tapping_term = GET_TAPPING_TERM(active_td, &(keyrecord_t){});
+    uint16_t elapsed      = timer_elapsed(last_tap_time);
+    if (elapsed <= tapping_term) {
+        feature_timer_schedule(FEATURE_TIMER_TAP_DANCE, tapping_term - elapsed + 1);
+        return;
+    }
 
     action = &tap_dance_actions[TD_INDEX(active_td)];
     if (!action->state.interrupted) {
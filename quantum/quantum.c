@@ -132,6 +132,10 @@ __attribute__((weak)) void unregister_code16(uint16_t code) {
  */
 __attribute__((weak)) void tap_code16_delay(uint16_t code, uint16_t delay) {
     register_code16(code);
+    if (delay > 0) {
+        // Make sure the press reaches the host before waiting, rather than along with the release
+        flush_keyboard_report();
+    }
     for (uint16_t i = delay; i > 0; i--) {
         wait_ms(1);
     }
@@ -174,6 +178,11 @@ __attribute__((weak)) void post_process_record_user(uint16_t keycode, keyrecord_
 
 void shutdown_quantum(bool jump_to_bootloader) {
     clear_keyboard();
+    // The released keys may still be held back by report coalescing, and the main loop will not run again
+    flush_keyboard_report();
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_MIRROR)
+    dynamic_keymap_flush();
+#endif
 #if defined(MIDI_ENABLE) && defined(MIDI_BASIC)
     process_midi_all_notes_off();
 #endif
@@ -256,140 +265,182 @@ void post_process_record_quantum(keyrecord_t *record) {
     post_process_record_kb(keycode, record);
 }
 
-/* Core keycode function, hands off handling to other functions,
-    then processes internal quantum keycodes, and then processes
-    ACTIONs.                                                      */
-bool process_record_quantum(keyrecord_t *record) {
-    uint16_t keycode = get_record_keycode(record, true);
-
-    // This is how you use actions here
-    // if (keycode == QK_LEADER) {
-    //   action_t action;
-    //   action.code = ACTION_DEFAULT_LAYER_SET(0);
-    //   process_action(record, action);
-    //   return false;
-    // }
-
-#if defined(SECURE_ENABLE)
-    if (!preprocess_secure(keycode, record)) {
-        return false;
-    }
+#if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
+static bool process_rgb_handler(uint16_t keycode, keyrecord_t *record) {
+    return process_rgb(keycode, record);
+}
 #endif
 
-#ifdef TAP_DANCE_ENABLE
-    if (preprocess_tap_dance(keycode, record)) {
-        // The tap dance might have updated the layer state, therefore the
-        // result of the keycode lookup might change.
-        keycode = get_record_keycode(record, true);
-    }
+#ifdef KEY_OVERRIDE_ENABLE
+static bool process_key_override_handler(uint16_t keycode, keyrecord_t *record) {
+    return process_key_override(keycode, record);
+}
 #endif
 
-#ifdef RGBLIGHT_ENABLE
-    if (record->event.pressed) {
-        preprocess_rgblight();
-    }
-#endif
+typedef struct {
+    uint16_t first;
+    uint16_t last;
+    bool (*process)(uint16_t keycode, keyrecord_t *record);
+} process_record_dispatch_t;
 
-#ifdef WPM_ENABLE
-    if (record->event.pressed) {
-        update_wpm(keycode);
-    }
-#endif
+// Handlers which look at every event, as opposed to only their own keycodes
+#define PROCESS_RECORD_ALL_KEYCODES 0x0000, 0xFFFF
 
-    if (!(
-#if defined(KEY_LOCK_ENABLE)
-            // Must run first to be able to mask key_up events.
-            process_key_lock(&keycode, record) &&
-#endif
+/* Handlers called by process_record_quantum(), in order. Each one is only
+   called for keycodes within [first, last], so handlers which only act on
+   their own keycode range are skipped for everything else. A handler
+   returning false stops the chain.                                      */
+static const process_record_dispatch_t process_record_handlers[] = {
 #if defined(DYNAMIC_MACRO_ENABLE) && !defined(DYNAMIC_MACRO_USER_CALL)
-            // Must run asap to ensure all keypresses are recorded.
-            process_dynamic_macro(keycode, record) &&
+    // Must run asap to ensure all keypresses are recorded.
+    {PROCESS_RECORD_ALL_KEYCODES, process_dynamic_macro},
 #endif
 #ifdef REPEAT_KEY_ENABLE
-            process_last_key(keycode, record) && process_repeat_key(keycode, record) &&
+    {PROCESS_RECORD_ALL_KEYCODES, process_last_key},
+    {PROCESS_RECORD_ALL_KEYCODES, process_repeat_key},
 #endif
 #if defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)
-            process_clicky(keycode, record) &&
+    {PROCESS_RECORD_ALL_KEYCODES, process_clicky},
 #endif
 #ifdef HAPTIC_ENABLE
-            process_haptic(keycode, record) &&
+    {PROCESS_RECORD_ALL_KEYCODES, process_haptic},
 #endif
 #if defined(VIA_ENABLE)
-            process_record_via(keycode, record) &&
+    {QK_MACRO, QK_MACRO_MAX, process_record_via},
 #endif
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
-            process_auto_mouse(keycode, record) &&
+    {PROCESS_RECORD_ALL_KEYCODES, process_auto_mouse},
 #endif
-            process_record_kb(keycode, record) &&
+    {PROCESS_RECORD_ALL_KEYCODES, process_record_kb},
 #if defined(SECURE_ENABLE)
-            process_secure(keycode, record) &&
+    {QK_SECURE_LOCK, QK_SECURE_REQUEST, process_secure},
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+    {QK_SEQUENCER, QK_SEQUENCER_MAX, process_sequencer},
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+    {QK_MIDI, QK_MIDI_MAX, process_midi},
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+    {QK_AUDIO, QK_AUDIO_MAX, process_audio},
 #endif
 #if defined(BACKLIGHT_ENABLE) || defined(LED_MATRIX_ENABLE)
-            process_backlight(keycode, record) &&
+    {QK_LIGHTING, QK_LIGHTING_MAX, process_backlight},
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+    {QK_STENO, QK_STENO_MAX, process_steno},
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
-            process_music(keycode, record) &&
+    {PROCESS_RECORD_ALL_KEYCODES, process_music},
 #endif
 #ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
+    {PROCESS_RECORD_ALL_KEYCODES, process_caps_word},
 #endif
 #ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
+    {PROCESS_RECORD_ALL_KEYCODES, process_key_override_handler},
 #endif
 #ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
+    {PROCESS_RECORD_ALL_KEYCODES, process_tap_dance},
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
-            process_unicode_common(keycode, record) &&
+#    ifdef UCIS_ENABLE
+    {PROCESS_RECORD_ALL_KEYCODES, process_unicode_common},
+#    else
+    // Input mode keycodes, followed by the Unicode and Unicode map ranges
+    {QK_UNICODE_MODE_NEXT, 0xFFFF, process_unicode_common},
+#    endif
 #endif
 #ifdef LEADER_ENABLE
-            process_leader(keycode, record) &&
+    {PROCESS_RECORD_ALL_KEYCODES, process_leader},
 #endif
 #ifdef AUTO_SHIFT_ENABLE
-            process_auto_shift(keycode, record) &&
+    {PROCESS_RECORD_ALL_KEYCODES, process_auto_shift},
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+    {QK_DYNAMIC_TAPPING_TERM_PRINT, QK_DYNAMIC_TAPPING_TERM_DOWN, process_dynamic_tapping_term},
 #endif
 #ifdef SPACE_CADET_ENABLE
-            process_space_cadet(keycode, record) &&
+    {PROCESS_RECORD_ALL_KEYCODES, process_space_cadet},
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+    {QK_MAGIC, QK_MAGIC_MAX, process_magic},
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+    {QK_GRAVE_ESCAPE, QK_GRAVE_ESCAPE, process_grave_esc},
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_rgb(keycode, record) &&
+    {QK_LIGHTING, QK_LIGHTING_MAX, process_rgb_handler},
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+    {QK_JOYSTICK, QK_JOYSTICK_MAX, process_joystick},
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+    {QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX, process_programmable_button},
 #endif
 #ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
+    {PROCESS_RECORD_ALL_KEYCODES, process_autocorrect},
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+    {QK_TRI_LAYER_LOWER, QK_TRI_LAYER_UPPER, process_tri_layer},
 #endif
-            true)) {
+};
+
+/* Core keycode function, hands off handling to other functions,
+    then processes internal quantum keycodes, and then processes
+    ACTIONs.                                                      */
+bool process_record_quantum(keyrecord_t *record) {
+    uint16_t keycode = get_record_keycode(record, true);
+
+    // This is how you use actions here
+    // if (keycode == QK_LEADER) {
+    //   action_t action;
+    //   action.code = ACTION_DEFAULT_LAYER_SET(0);
+    //   process_action(record, action);
+    //   return false;
+    // }
+
+#if defined(SECURE_ENABLE)
+    if (!preprocess_secure(keycode, record)) {
         return false;
     }
+#endif
+
+#ifdef TAP_DANCE_ENABLE
+    if (preprocess_tap_dance(keycode, record)) {
+        // The tap dance might have updated the layer state, therefore the
+        // result of the keycode lookup might change.
+        keycode = get_record_keycode(record, true);
+    }
+#endif
+
+#ifdef RGBLIGHT_ENABLE
+    if (record->event.pressed) {
+        preprocess_rgblight();
+    }
+#endif
+
+#ifdef WPM_ENABLE
+    if (record->event.pressed) {
+        update_wpm(keycode);
+    }
+#endif
+
+#if defined(KEY_LOCK_ENABLE)
+    // Must run first to be able to mask key_up events.
+    if (!process_key_lock(&keycode, record)) {
+        return false;
+    }
+#endif
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(process_record_handlers); i++) {
+        const process_record_dispatch_t *handler = &process_record_handlers[i];
+        if (keycode < handler->first || keycode > handler->last) {
+            continue;
+        }
+        if (!handler->process(keycode, record)) {
+            return false;
+        }
+    }
 
     if (record->event.pressed) {
         switch (keycode) {
@@ -0,0 +1,24 @@
+#pragma once
+
+typedef HSV (*dist_angle_f)(HSV hsv, uint8_t dist, uint8_t angle, uint8_t time);
+
+bool effect_runner_dist_angle(effect_params_t* params, dist_angle_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    uint8_t time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+        uint8_t dist  = g_rgb_led_geometry[i].dist;
+        uint8_t angle = g_rgb_led_geometry[i].angle;
+#else
+        int16_t dx    = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy    = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        uint8_t dist  = sqrt16(dx * dx + dy * dy);
+        uint8_t angle = atan2_8(dy, dx);
+#endif
+        RGB rgb = rgb_matrix_hsv_to_rgb(effect_func(rgb_matrix_config.hsv, dist, angle, time));
+        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+    return rgb_matrix_check_finished_leds(led_max);
+}
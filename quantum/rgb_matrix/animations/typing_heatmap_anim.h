@@ -24,6 +24,26 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
     if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
         return;
     }
+#            if defined(RGB_MATRIX_NEIGHBOR_TABLE) && RGB_MATRIX_TYPING_HEATMAP_SPREAD <= RGB_MATRIX_NEIGHBOR_RADIUS
+    // Only visit the keys close enough to be warmed up, rather than sweeping the whole matrix
+    const led_neighbor_t *neighbors;
+    uint8_t               count;
+    if (rgb_matrix_get_neighbors(g_led_config.matrix_co[row][col], &neighbors, &count)) {
+        g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+        for (uint8_t i = 0; i < count; i++) {
+            uint8_t i_row, i_col;
+            if (neighbors[i].dist > RGB_MATRIX_TYPING_HEATMAP_SPREAD || !rgb_matrix_map_led_to_row_column(neighbors[i].index, &i_row, &i_col)) {
+                continue;
+            }
+            uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, neighbors[i].dist);
+            if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
+                amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
+            }
+            g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
+        }
+        return;
+    }
+#            endif
     for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
         for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
             if (g_led_config.matrix_co[i_row][i_col] == NO_LED) { // skip as target key doesn't have an led position
@@ -69,6 +69,19 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+led_geometry_t g_rgb_led_geometry[RGB_MATRIX_LED_COUNT];
+#endif // RGB_MATRIX_GEOMETRY_CACHE
+
+#ifdef RGB_MATRIX_NEIGHBOR_TABLE
+// The neighbors of each LED are stored one after another in rgb_neighbors, sorted by index
+#    define NEIGHBORS_OVERFLOW UINT8_MAX
+static uint16_t       rgb_neighbor_offset[RGB_MATRIX_LED_COUNT];
+static uint8_t        rgb_neighbor_count[RGB_MATRIX_LED_COUNT];
+static led_neighbor_t rgb_neighbors[RGB_MATRIX_NEIGHBOR_TABLE_SIZE];
+static uint8_t        rgb_led_row[RGB_MATRIX_LED_COUNT];
+static uint8_t        rgb_led_col[RGB_MATRIX_LED_COUNT];
+#endif // RGB_MATRIX_NEIGHBOR_TABLE
 
 // internals
 static bool            suspend_state     = false;
@@ -390,6 +403,10 @@ void rgb_matrix_task(void) {
             }
             break;
         case FLUSHING:
+            // leave the driver sending the previous frame rather than waiting for it
+            if (rgb_matrix_driver.flush_busy && rgb_matrix_driver.flush_busy()) {
+                break;
+            }
             rgb_task_flush(effect);
             break;
         case SYNCING:
@@ -458,9 +475,131 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+#ifdef RGB_MATRIX_NEIGHBOR_TABLE
+static void rgb_matrix_update_neighbors(void) {
+    memset(rgb_led_row, NO_LED, sizeof(rgb_led_row));
+    memset(rgb_led_col, NO_LED, sizeof(rgb_led_col));
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t led = g_led_config.matrix_co[row][col];
+            if (led != NO_LED && rgb_led_row[led] == NO_LED) {
+                rgb_led_row[led] = row;
+                rgb_led_col[led] = col;
+            }
+        }
+    }
+
+    uint16_t size = 0;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        uint16_t start = size;
+        for (uint8_t j = 0; j < RGB_MATRIX_LED_COUNT && size <= RGB_MATRIX_NEIGHBOR_TABLE_SIZE; j++) {
+            int16_t dx = g_led_config.point[j].x - g_led_config.point[i].x;
+            int16_t dy = g_led_config.point[j].y - g_led_config.point[i].y;
+            if (j == i || abs(dx) > RGB_MATRIX_NEIGHBOR_RADIUS || abs(dy) > RGB_MATRIX_NEIGHBOR_RADIUS) {
+                continue;
+            }
+            uint8_t dist = sqrt16(dx * dx + dy * dy);
+            if (dist > RGB_MATRIX_NEIGHBOR_RADIUS) {
+                continue;
+            }
+            if (size < RGB_MATRIX_NEIGHBOR_TABLE_SIZE) {
+                rgb_neighbors[size].index = j;
+                rgb_neighbors[size].dist  = dist;
+            }
+            size++;
+        }
+
+        rgb_neighbor_offset[i] = start;
+        if (size > RGB_MATRIX_NEIGHBOR_TABLE_SIZE) {
+            // Leave the table full, the remaining LEDs compute their distances instead
+            rgb_neighbor_count[i] = NEIGHBORS_OVERFLOW;
+            size                  = RGB_MATRIX_NEIGHBOR_TABLE_SIZE + 1;
+        } else if (size - start >= NEIGHBORS_OVERFLOW) {
+            // The count would read as NEIGHBORS_OVERFLOW, so this LED computes its distances too
+            rgb_neighbor_count[i] = NEIGHBORS_OVERFLOW;
+            size                  = start;
+        } else {
+            rgb_neighbor_count[i] = size - start;
+        }
+    }
+    if (size > RGB_MATRIX_NEIGHBOR_TABLE_SIZE) {
+        dprintf("rgb_matrix_update_neighbors RGB_MATRIX_NEIGHBOR_TABLE_SIZE is too small\n");
+    }
+}
+
+bool rgb_matrix_get_neighbors(uint8_t led, const led_neighbor_t **neighbors, uint8_t *count) {
+    if (led >= RGB_MATRIX_LED_COUNT || rgb_neighbor_count[led] == NEIGHBORS_OVERFLOW) {
+        return false;
+    }
+    *neighbors = &rgb_neighbors[rgb_neighbor_offset[led]];
+    *count     = rgb_neighbor_count[led];
+    return true;
+}
+
+bool rgb_matrix_get_neighbor_distance(uint8_t led, uint8_t other, uint8_t *dist) {
+    const led_neighbor_t *neighbors;
+    uint8_t               count;
+    if (led == other) {
+        *dist = 0;
+        return true;
+    }
+    if (!rgb_matrix_get_neighbors(led, &neighbors, &count)) {
+        return false;
+    }
+
+    uint8_t low  = 0;
+    uint8_t high = count;
+    while (low < high) {
+        uint8_t mid = (low + high) / 2;
+        if (neighbors[mid].index < other) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low == count || neighbors[low].index != other) {
+        return false;
+    }
+    *dist = neighbors[low].dist;
+    return true;
+}
+
+bool rgb_matrix_map_led_to_row_column(uint8_t led, uint8_t *row, uint8_t *column) {
+    if (led >= RGB_MATRIX_LED_COUNT || rgb_led_row[led] == NO_LED) {
+        return false;
+    }
+    *row    = rgb_led_row[led];
+    *column = rgb_led_col[led];
+    return true;
+}
+#endif // RGB_MATRIX_NEIGHBOR_TABLE
+
+#if defined(RGB_MATRIX_GEOMETRY_CACHE) || defined(RGB_MATRIX_NEIGHBOR_TABLE)
+void rgb_matrix_update_geometry(void) {
+#    ifdef RGB_MATRIX_GEOMETRY_CACHE
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy = g_led_config.point[i].y - k_rgb_matrix_center.y;
+
+        g_rgb_led_geometry[i].dx    = dx;
+        g_rgb_led_geometry[i].dy    = dy;
+        g_rgb_led_geometry[i].dist  = sqrt16(dx * dx + dy * dy);
+        g_rgb_led_geometry[i].angle = atan2_8(dy, dx);
+    }
+#    endif
+#    ifdef RGB_MATRIX_NEIGHBOR_TABLE
+    rgb_matrix_update_neighbors();
+#    endif
+}
+#endif
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#if defined(RGB_MATRIX_GEOMETRY_CACHE) || defined(RGB_MATRIX_NEIGHBOR_TABLE)
+    rgb_matrix_update_geometry();
+#endif
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
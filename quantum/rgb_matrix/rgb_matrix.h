@@ -107,6 +107,15 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+#ifdef RGB_MATRIX_NEIGHBOR_TABLE
+#    ifndef RGB_MATRIX_NEIGHBOR_RADIUS
+#        define RGB_MATRIX_NEIGHBOR_RADIUS 40
+#    endif
+#    ifndef RGB_MATRIX_NEIGHBOR_TABLE_SIZE
+#        define RGB_MATRIX_NEIGHBOR_TABLE_SIZE (RGB_MATRIX_LED_COUNT * 16)
+#    endif
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -181,6 +190,20 @@ bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void rgb_matrix_init(void);
 
+#if defined(RGB_MATRIX_GEOMETRY_CACHE) || defined(RGB_MATRIX_NEIGHBOR_TABLE)
+// Recomputes the LED geometry tables, for keyboards that change g_led_config after init
+void rgb_matrix_update_geometry(void);
+#endif
+
+#ifdef RGB_MATRIX_NEIGHBOR_TABLE
+// Returns false if the neighbors of led did not fit in RGB_MATRIX_NEIGHBOR_TABLE_SIZE
+bool rgb_matrix_get_neighbors(uint8_t led, const led_neighbor_t **neighbors, uint8_t *count);
+// Returns false if other is further than RGB_MATRIX_NEIGHBOR_RADIUS from led, or not in the table
+bool rgb_matrix_get_neighbor_distance(uint8_t led, uint8_t other, uint8_t *dist);
+// Returns false if no key is mapped to led in g_led_config.matrix_co
+bool rgb_matrix_map_led_to_row_column(uint8_t led, uint8_t *row, uint8_t *column);
+#endif
+
 void rgb_matrix_reload_from_eeprom(void);
 
 void        rgb_matrix_set_suspend_state(bool state);
@@ -281,6 +304,8 @@ typedef struct {
     void (*set_color_all)(uint8_t r, uint8_t g, uint8_t b);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+    /* Optional, whether the previous flush is still being sent to the hardware. */
+    bool (*flush_busy)(void);
 } rgb_matrix_driver_t;
 
 static inline bool rgb_matrix_check_finished_leds(uint8_t led_idx) {
@@ -307,3 +332,6 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+extern led_geometry_t g_rgb_led_geometry[RGB_MATRIX_LED_COUNT];
+#endif
@@ -19,7 +19,7 @@
 
 /* Each driver needs to define the struct
  *    const rgb_matrix_driver_t rgb_matrix_driver;
- * All members must be provided.
+ * All members must be provided, except flush_busy which may be left unset.
  * Keyboard custom drivers can define this in their own files, it should only
  * be here if shared between boards.
  */
@@ -38,6 +38,9 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3731_flush,
     .set_color     = is31fl3731_set_color,
     .set_color_all = is31fl3731_set_color_all,
+#    ifdef I2C_ASYNC_ENABLE
+    .flush_busy = is31fl3731_flush_busy,
+#    endif
 };
 
 #elif defined(RGB_MATRIX_IS31FL3733)
@@ -46,6 +49,9 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3733_flush,
     .set_color     = is31fl3733_set_color,
     .set_color_all = is31fl3733_set_color_all,
+#    ifdef I2C_ASYNC_ENABLE
+    .flush_busy = is31fl3733_flush_busy,
+#    endif
 };
 
 #elif defined(RGB_MATRIX_IS31FL3736)
@@ -54,6 +60,9 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3736_flush,
     .set_color     = is31fl3736_set_color,
     .set_color_all = is31fl3736_set_color_all,
+#    ifdef I2C_ASYNC_ENABLE
+    .flush_busy = is31fl3736_flush_busy,
+#    endif
 };
 
 #elif defined(RGB_MATRIX_IS31FL3737)
@@ -62,6 +71,9 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3737_flush,
     .set_color     = is31fl3737_set_color,
     .set_color_all = is31fl3737_set_color_all,
+#    ifdef I2C_ASYNC_ENABLE
+    .flush_busy = is31fl3737_flush_busy,
+#    endif
 };
 
 #elif defined(RGB_MATRIX_IS31FL3741)
@@ -156,6 +168,9 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = flush,
     .set_color     = setled,
     .set_color_all = setled_all,
+#    ifdef WS2812_DOUBLE_BUFFER
+    .flush_busy = ws2812_frame_in_flight,
+#    endif
 };
 
 #endif
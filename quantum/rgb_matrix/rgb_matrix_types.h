@@ -16,6 +16,10 @@
 
 #pragma once
 
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
 #include <stdint.h>
 #include <stdbool.h>
 #include "color.h"
@@ -55,6 +59,20 @@ typedef struct PACKED {
     uint8_t y;
 } led_point_t;
 
+// Position of an LED relative to k_rgb_matrix_center, see RGB_MATRIX_GEOMETRY_CACHE
+typedef struct {
+    int16_t dx;
+    int16_t dy;
+    uint8_t dist;
+    uint8_t angle;
+} led_geometry_t;
+
+// An LED within RGB_MATRIX_NEIGHBOR_RADIUS of another one, see RGB_MATRIX_NEIGHBOR_TABLE
+typedef struct {
+    uint8_t index;
+    uint8_t dist;
+} led_neighbor_t;
+
 #define HAS_FLAGS(bits, flags) ((bits & flags) == flags)
 #define HAS_ANY_FLAGS(bits, flags) ((bits & flags) != 0x00)
 
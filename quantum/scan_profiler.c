@@ -0,0 +1,201 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "scan_profiler.h"
+#include "print.h"
+#include "debug.h"
+
+#if SCAN_PROFILER_HISTOGRAM_BUCKETS < 2 || SCAN_PROFILER_HISTOGRAM_BUCKETS > 64
+#    error "SCAN_PROFILER_HISTOGRAM_BUCKETS must be between 2 and 64"
+#endif
+
+// Only the slots of enabled features are given storage, slot_storage maps slot IDs to it
+enum scan_profiler_storage_t {
+    STORAGE_KEYBOARD_TASK,
+    STORAGE_MATRIX_TASK,
+    STORAGE_MATRIX_SCAN,
+    STORAGE_DEBOUNCE,
+    STORAGE_ACTION_EXEC,
+    STORAGE_QUANTUM_TASK,
+#ifdef SPLIT_KEYBOARD
+    STORAGE_SPLIT_TRANSACTIONS,
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+    STORAGE_KEY_OVERRIDE_TASK,
+#endif
+#ifdef TAP_DANCE_ENABLE
+    STORAGE_TAP_DANCE_TASK,
+#endif
+#ifdef COMBO_ENABLE
+    STORAGE_COMBO_TASK,
+#endif
+#ifdef LEADER_ENABLE
+    STORAGE_LEADER_TASK,
+#endif
+#ifdef RGBLIGHT_ENABLE
+    STORAGE_RGBLIGHT_TASK,
+#endif
+#ifdef LED_MATRIX_ENABLE
+    STORAGE_LED_MATRIX_TASK,
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    STORAGE_RGB_MATRIX_TASK,
+#endif
+#ifdef OLED_ENABLE
+    STORAGE_OLED_TASK,
+#endif
+#ifdef ST7565_ENABLE
+    STORAGE_ST7565_TASK,
+#endif
+#ifdef QUANTUM_PAINTER_ENABLE
+    STORAGE_PAINTER_TASK,
+#endif
+#ifdef DEFERRED_EXEC_ENABLE
+    STORAGE_DEFERRED_EXEC_TASK,
+#endif
+    STORAGE_HOUSEKEEPING_TASK,
+    STORAGE_USER,
+    STORAGE_COUNT,
+};
+
+// Storage index of every slot plus one, 0 for the slots of disabled features
+static const uint8_t slot_storage[SCAN_PROFILER_SLOT_COUNT] = {
+    [SCAN_PROFILER_KEYBOARD_TASK] = STORAGE_KEYBOARD_TASK + 1,
+    [SCAN_PROFILER_MATRIX_TASK]   = STORAGE_MATRIX_TASK + 1,
+    [SCAN_PROFILER_MATRIX_SCAN]   = STORAGE_MATRIX_SCAN + 1,
+    [SCAN_PROFILER_DEBOUNCE]      = STORAGE_DEBOUNCE + 1,
+    [SCAN_PROFILER_ACTION_EXEC]   = STORAGE_ACTION_EXEC + 1,
+    [SCAN_PROFILER_QUANTUM_TASK]  = STORAGE_QUANTUM_TASK + 1,
+#ifdef SPLIT_KEYBOARD
+    [SCAN_PROFILER_SPLIT_TRANSACTIONS] = STORAGE_SPLIT_TRANSACTIONS + 1,
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+    [SCAN_PROFILER_KEY_OVERRIDE_TASK] = STORAGE_KEY_OVERRIDE_TASK + 1,
+#endif
+#ifdef TAP_DANCE_ENABLE
+    [SCAN_PROFILER_TAP_DANCE_TASK] = STORAGE_TAP_DANCE_TASK + 1,
+#endif
+#ifdef COMBO_ENABLE
+    [SCAN_PROFILER_COMBO_TASK] = STORAGE_COMBO_TASK + 1,
+#endif
+#ifdef LEADER_ENABLE
+    [SCAN_PROFILER_LEADER_TASK] = STORAGE_LEADER_TASK + 1,
+#endif
+#ifdef RGBLIGHT_ENABLE
+    [SCAN_PROFILER_RGBLIGHT_TASK] = STORAGE_RGBLIGHT_TASK + 1,
+#endif
+#ifdef LED_MATRIX_ENABLE
+    [SCAN_PROFILER_LED_MATRIX_TASK] = STORAGE_LED_MATRIX_TASK + 1,
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    [SCAN_PROFILER_RGB_MATRIX_TASK] = STORAGE_RGB_MATRIX_TASK + 1,
+#endif
+#ifdef OLED_ENABLE
+    [SCAN_PROFILER_OLED_TASK] = STORAGE_OLED_TASK + 1,
+#endif
+#ifdef ST7565_ENABLE
+    [SCAN_PROFILER_ST7565_TASK] = STORAGE_ST7565_TASK + 1,
+#endif
+#ifdef QUANTUM_PAINTER_ENABLE
+    [SCAN_PROFILER_PAINTER_TASK] = STORAGE_PAINTER_TASK + 1,
+#endif
+#ifdef DEFERRED_EXEC_ENABLE
+    [SCAN_PROFILER_DEFERRED_EXEC_TASK] = STORAGE_DEFERRED_EXEC_TASK + 1,
+#endif
+    [SCAN_PROFILER_HOUSEKEEPING_TASK] = STORAGE_HOUSEKEEPING_TASK + 1,
+    [SCAN_PROFILER_USER]              = STORAGE_USER + 1,
+};
+
+typedef struct scan_profiler_slot_state_t {
+    timing_histogram_t summary;
+    uint16_t           histogram[SCAN_PROFILER_HISTOGRAM_BUCKETS];
+} scan_profiler_slot_state_t;
+
+static scan_profiler_slot_state_t slots[STORAGE_COUNT];
+static uint32_t                   interval_start = 0;
+
+static const char *const slot_names[SCAN_PROFILER_SLOT_COUNT] = {
+    [SCAN_PROFILER_KEYBOARD_TASK]      = "keyboard_task",
+    [SCAN_PROFILER_MATRIX_TASK]        = "matrix_task",
+    [SCAN_PROFILER_MATRIX_SCAN]        = "matrix_scan",
+    [SCAN_PROFILER_DEBOUNCE]           = "debounce",
+    [SCAN_PROFILER_ACTION_EXEC]        = "action_exec",
+    [SCAN_PROFILER_QUANTUM_TASK]       = "quantum_task",
+    [SCAN_PROFILER_SPLIT_TRANSACTIONS] = "split_transactions",
+    [SCAN_PROFILER_KEY_OVERRIDE_TASK]  = "key_override_task",
+    [SCAN_PROFILER_TAP_DANCE_TASK]     = "tap_dance_task",
+    [SCAN_PROFILER_COMBO_TASK]         = "combo_task",
+    [SCAN_PROFILER_LEADER_TASK]        = "leader_task",
+    [SCAN_PROFILER_RGBLIGHT_TASK]      = "rgblight_task",
+    [SCAN_PROFILER_LED_MATRIX_TASK]    = "led_matrix_task",
+    [SCAN_PROFILER_RGB_MATRIX_TASK]    = "rgb_matrix_task",
+    [SCAN_PROFILER_OLED_TASK]          = "oled_task",
+    [SCAN_PROFILER_ST7565_TASK]        = "st7565_task",
+    [SCAN_PROFILER_PAINTER_TASK]       = "qp_internal_task",
+    [SCAN_PROFILER_DEFERRED_EXEC_TASK] = "deferred_exec_task",
+    [SCAN_PROFILER_HOUSEKEEPING_TASK]  = "housekeeping_task",
+    [SCAN_PROFILER_USER]               = "user",
+};
+
+static scan_profiler_slot_state_t *slot_state(scan_profiler_slot_t slot) {
+    if (slot >= SCAN_PROFILER_SLOT_COUNT || !slot_storage[slot]) {
+        return NULL;
+    }
+    return &slots[slot_storage[slot] - 1];
+}
+
+void scan_profiler_record(scan_profiler_slot_t slot, uint32_t ticks) {
+    scan_profiler_slot_state_t *state = slot_state(slot);
+    if (!state) {
+        return;
+    }
+
+    timing_histogram_record(&state->summary, state->histogram, SCAN_PROFILER_HISTOGRAM_BUCKETS, ticks);
+}
+
+bool scan_profiler_get_stats(scan_profiler_slot_t slot, scan_profiler_stats_t *stats) {
+    const scan_profiler_slot_state_t *state = slot_state(slot);
+    if (!state) {
+        return false;
+    }
+
+    timing_histogram_get_stats(&state->summary, state->histogram, SCAN_PROFILER_HISTOGRAM_BUCKETS, stats);
+    return true;
+}
+
+const char *scan_profiler_slot_name(scan_profiler_slot_t slot) {
+    if (slot >= SCAN_PROFILER_SLOT_COUNT || !slot_names[slot]) {
+        return "unknown";
+    }
+    return slot_names[slot];
+}
+
+void scan_profiler_reset(void) {
+    memset(slots, 0, sizeof(slots));
+}
+
+void scan_profiler_print(void) {
+    uprintf("scan profiler: %lu ticks/s\n", (unsigned long)timer_hires_frequency());
+    for (uint8_t i = 0; i < SCAN_PROFILER_SLOT_COUNT; i++) {
+        scan_profiler_stats_t stats;
+        if (!scan_profiler_get_stats(i, &stats) || stats.count == 0) {
+            continue;
+        }
+        uprintf("%-20s n=%lu min=%lu p50=%lu p99=%lu max=%lu mean=%lu\n", scan_profiler_slot_name(i), (unsigned long)stats.count, (unsigned long)stats.min, (unsigned long)stats.p50, (unsigned long)stats.p99, (unsigned long)stats.max, (unsigned long)stats.mean);
+    }
+}
+
+void scan_profiler_task(void) {
+    if (timer_elapsed32(interval_start) < SCAN_PROFILER_INTERVAL) {
+        return;
+    }
+    interval_start = timer_read32();
+
+#ifdef CONSOLE_ENABLE
+    if (debug_enable) {
+        scan_profiler_print();
+    }
+#endif
+    scan_profiler_reset();
+}
@@ -0,0 +1,118 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "timer.h"
+#include "timing_histogram.h"
+
+/*
+    The scan profiler records how long each stage of the main loop takes, measured with timer_read_hires().
+
+    Each instrumented stage owns a slot holding min/max/count/sum and a logarithmic histogram (two buckets per
+    power of two), which allows p50/p99 to be estimated within a fixed RAM budget. Statistics are accumulated
+    over SCAN_PROFILER_INTERVAL milliseconds, optionally printed to the console, then reset.
+
+    Usage example, for code outside of the core instrumentation:
+
+        SCAN_PROFILE(SCAN_PROFILER_USER, {
+            my_expensive_task();
+        });
+*/
+
+#ifndef SCAN_PROFILER_HISTOGRAM_BUCKETS
+#    define SCAN_PROFILER_HISTOGRAM_BUCKETS 32
+#endif
+
+#ifndef SCAN_PROFILER_INTERVAL
+#    define SCAN_PROFILER_INTERVAL 10000
+#endif
+
+/*
+    Slot IDs are the same whatever features are enabled, slots of disabled features never get any samples.
+    Append new slots before SCAN_PROFILER_SLOT_COUNT, never renumber existing ones.
+*/
+typedef enum scan_profiler_slot_t {
+    SCAN_PROFILER_KEYBOARD_TASK      = 0,
+    SCAN_PROFILER_MATRIX_TASK        = 1,
+    SCAN_PROFILER_MATRIX_SCAN        = 2,
+    SCAN_PROFILER_DEBOUNCE           = 3,
+    SCAN_PROFILER_ACTION_EXEC        = 4,
+    SCAN_PROFILER_QUANTUM_TASK       = 5,
+    SCAN_PROFILER_SPLIT_TRANSACTIONS = 6,
+    SCAN_PROFILER_KEY_OVERRIDE_TASK  = 7,
+    SCAN_PROFILER_TAP_DANCE_TASK     = 8,
+    SCAN_PROFILER_COMBO_TASK         = 9,
+    SCAN_PROFILER_LEADER_TASK        = 10,
+    SCAN_PROFILER_RGBLIGHT_TASK      = 11,
+    SCAN_PROFILER_LED_MATRIX_TASK    = 12,
+    SCAN_PROFILER_RGB_MATRIX_TASK    = 13,
+    SCAN_PROFILER_OLED_TASK          = 14,
+    SCAN_PROFILER_ST7565_TASK        = 15,
+    SCAN_PROFILER_PAINTER_TASK       = 16,
+    SCAN_PROFILER_DEFERRED_EXEC_TASK = 17,
+    SCAN_PROFILER_HOUSEKEEPING_TASK  = 18,
+    SCAN_PROFILER_USER               = 19,
+    SCAN_PROFILER_SLOT_COUNT         = 20,
+} scan_profiler_slot_t;
+
+typedef timing_histogram_stats_t scan_profiler_stats_t;
+
+#ifdef SCAN_PROFILER_ENABLE
+
+#    define SCAN_PROFILE_BEGIN(slot) const uint32_t scan_profiler_start_##slot = timer_read_hires()
+#    define SCAN_PROFILE_END(slot) scan_profiler_record(slot, TIMER_DIFF_32(timer_read_hires(), scan_profiler_start_##slot))
+
+#else
+
+#    define SCAN_PROFILE_BEGIN(slot) \
+        do {                         \
+        } while (0)
+#    define SCAN_PROFILE_END(slot) \
+        do {                       \
+        } while (0)
+
+#endif // SCAN_PROFILER_ENABLE
+
+#define SCAN_PROFILE(slot, call) \
+    do {                          \
+        SCAN_PROFILE_BEGIN(slot); \
+        do {                      \
+            call;                 \
+        } while (0);              \
+        SCAN_PROFILE_END(slot);   \
+    } while (0)
+
+/**
+ * @brief Records a single duration, in timer_read_hires() ticks, against the given slot.
+ */
+void scan_profiler_record(scan_profiler_slot_t slot, uint32_t ticks);
+
+/**
+ * @brief Computes summary statistics for the given slot over the current interval.
+ *
+ * @return false if the slot is out of range
+ */
+bool scan_profiler_get_stats(scan_profiler_slot_t slot, scan_profiler_stats_t *stats);
+
+/**
+ * @brief Returns a printable name for the given slot.
+ */
+const char *scan_profiler_slot_name(scan_profiler_slot_t slot);
+
+/**
+ * @brief Clears all accumulated statistics.
+ */
+void scan_profiler_reset(void);
+
+/**
+ * @brief Prints statistics for every slot which has samples to the console.
+ */
+void scan_profiler_print(void);
+
+/**
+ * @brief Rolls over the statistics interval, printing results if the console is enabled. Should not be invoked by keyboard/user code.
+ */
+void scan_profiler_task(void);
@@ -22,7 +22,14 @@
 #include "quantum_keycodes.h"
 #include "keycode.h"
 #include "action.h"
+#include "action_util.h"
 #include "wait.h"
+#ifdef SEND_STRING_BATCH
+#    include <string.h>
+#    include "action_util.h"
+#    include "keycode_config.h"
+#    include "util.h"
+#endif
 
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
@@ -146,6 +153,87 @@ __attribute__((weak)) const uint8_t ascii_to_keycode_lut[128] PROGMEM = {
 // Note: we bit-pack in "reverse" order to optimize loading
 #define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
 
+#ifdef SEND_STRING_BATCH
+#    ifndef SEND_STRING_BATCH_SIZE
+#        define SEND_STRING_BATCH_SIZE KEYBOARD_REPORT_KEYS
+#    endif
+
+/* Characters are typed with rollover: each key is pressed in a report of its own, so that the host sees them in
+ * order, but the held keys are only released together, once a character can't be pressed on top of them. This takes
+ * one report per character, and one per batch, instead of two per character.
+ */
+static uint8_t batch_keys[SEND_STRING_BATCH_SIZE];
+static uint8_t batch_count = 0;
+static uint8_t batch_mods  = 0;
+
+// Releases the held keys, and the modifiers not in `mods`, in a single report
+static void send_string_batch_release(uint8_t mods) {
+    bool changed = batch_count > 0;
+    for (uint8_t i = 0; i < batch_count; i++) {
+        del_key(batch_keys[i]);
+    }
+    batch_count = 0;
+    if (batch_mods & ~mods) {
+        del_mods(batch_mods & ~mods);
+        batch_mods &= mods;
+        changed = true;
+    }
+    if (changed) {
+        send_keyboard_report();
+    }
+}
+#endif
+
+// Types a character of a string, on top of the previous ones when they can be batched
+static void send_string_char(char ascii_code, uint8_t interval) {
+#ifdef SEND_STRING_BATCH
+    uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    uint8_t mods    = 0;
+    if (PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code)) {
+        mods |= MOD_BIT(KC_LEFT_SHIFT);
+    }
+    if (PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code)) {
+        mods |= MOD_BIT(KC_RIGHT_ALT);
+    }
+
+    // Characters typed with a delay, dead keys, and the bell are typed on their own
+    if (interval == 0 && keycode != KC_NO && !PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code)) {
+        uint8_t limit = SEND_STRING_BATCH_SIZE;
+#    ifdef NKRO_ENABLE
+        if (!keymap_config.nkro)
+#    endif
+        {
+            limit = MIN(limit, KEYBOARD_REPORT_KEYS);
+        }
+        if (mods != batch_mods || batch_count >= limit || memchr(batch_keys, keycode, batch_count)) {
+            send_string_batch_release(mods);
+        }
+        if (mods & ~batch_mods) {
+            register_mods(mods & ~batch_mods);
+            batch_mods = mods;
+        }
+        register_code(keycode);
+        batch_keys[batch_count++] = keycode;
+#    if TAP_CODE_DELAY > 0
+        flush_keyboard_report();
+#    endif
+        for (uint16_t i = TAP_CODE_DELAY; i > 0; i--) {
+            wait_ms(1);
+        }
+        return;
+    }
+    send_string_batch_release(0);
+#endif
+    send_char(ascii_code);
+}
+
+// Releases what the characters of a string left held, before anything else is typed
+static void send_string_end_batch(void) {
+#ifdef SEND_STRING_BATCH
+    send_string_batch_release(0);
+#endif
+}
+
 void send_string(const char *string) {
     send_string_with_delay(string, 0);
 }
@@ -155,6 +243,7 @@ void send_string_with_delay(const char *string, uint8_t interval) {
         char ascii_code = *string;
         if (!ascii_code) break;
         if (ascii_code == SS_QMK_PREFIX) {
+            send_string_end_batch();
             ascii_code = *(++string);
             if (ascii_code == SS_TAP_CODE) {
                 // tap
@@ -177,20 +266,23 @@ void send_string_with_delay(const char *string, uint8_t interval) {
                     ms += keycode - '0';
                     keycode = *(++string);
                 }
+                flush_keyboard_report();
                 while (ms--)
                     wait_ms(1);
             }
         } else {
-            send_char(ascii_code);
+            send_string_char(ascii_code, interval);
         }
         ++string;
         // interval
-        {
+        if (interval) {
             uint8_t ms = interval;
+            flush_keyboard_report();
             while (ms--)
                 wait_ms(1);
         }
     }
+    send_string_end_batch();
 }
 
 void send_char(char ascii_code) {
@@ -288,6 +380,7 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
         char ascii_code = pgm_read_byte(string);
         if (!ascii_code) break;
         if (ascii_code == SS_QMK_PREFIX) {
+            send_string_end_batch();
             ascii_code = pgm_read_byte(++string);
             if (ascii_code == SS_TAP_CODE) {
                 // tap
@@ -310,19 +403,22 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
                     ms += keycode - '0';
                     keycode = pgm_read_byte(++string);
                 }
+                flush_keyboard_report();
                 while (ms--)
                     wait_ms(1);
             }
         } else {
-            send_char(ascii_code);
+            send_string_char(ascii_code, interval);
         }
         ++string;
         // interval
-        {
+        if (interval) {
             uint8_t ms = interval;
+            flush_keyboard_report();
             while (ms--)
                 wait_ms(1);
         }
     }
+    send_string_end_batch();
 }
 #endif
@@ -0,0 +1,81 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "timing_histogram.h"
+
+static uint8_t bucket_for_value(uint32_t value, uint8_t bucket_count) {
+    if (value < 2) {
+        return value;
+    }
+    uint8_t msb    = (sizeof(unsigned long) * 8 - 1) - __builtin_clzl(value);
+    uint8_t bucket = (msb * 2) + ((value >> (msb - 1)) & 1);
+    return bucket < bucket_count ? bucket : bucket_count - 1;
+}
+
+static uint32_t bucket_upper_bound(uint8_t bucket) {
+    if (bucket < 2) {
+        return bucket;
+    }
+    uint8_t  msb   = bucket / 2;
+    uint32_t lower = (1UL << msb) | ((uint32_t)(bucket & 1) << (msb - 1));
+    return lower + (1UL << (msb - 1)) - 1;
+}
+
+static uint32_t percentile(const timing_histogram_t *hist, const uint16_t *buckets, uint8_t bucket_count, uint8_t percent) {
+    // Buckets are rescaled when one of them saturates, so they may hold fewer samples than hist->count
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < bucket_count; i++) {
+        total += buckets[i];
+    }
+
+    // Number of samples at or below the requested percentile, rounded up
+    uint32_t target = (uint32_t)(((uint64_t)total * percent + 99) / 100);
+    uint32_t seen   = 0;
+    for (uint8_t i = 0; i < bucket_count; i++) {
+        seen += buckets[i];
+        if (seen >= target) {
+            uint32_t bound = bucket_upper_bound(i);
+            // The last bucket is open-ended, and the upper bound of any bucket may exceed the observed maximum
+            if (i == bucket_count - 1 || bound > hist->max) {
+                bound = hist->max;
+            }
+            return bound < hist->min ? hist->min : bound;
+        }
+    }
+    return hist->max;
+}
+
+void timing_histogram_record(timing_histogram_t *hist, uint16_t *buckets, uint8_t bucket_count, uint32_t value) {
+    if (hist->count == 0 || value < hist->min) {
+        hist->min = value;
+    }
+    if (value > hist->max) {
+        hist->max = value;
+    }
+    hist->count++;
+    hist->sum += value;
+
+    uint16_t *bucket = &buckets[bucket_for_value(value, bucket_count)];
+    if (*bucket == UINT16_MAX) {
+        // Halve every bucket rather than letting this one stick, which keeps their proportions and thus the percentiles
+        for (uint8_t i = 0; i < bucket_count; i++) {
+            buckets[i] = (buckets[i] + 1) / 2;
+        }
+    }
+    (*bucket)++;
+}
+
+void timing_histogram_get_stats(const timing_histogram_t *hist, const uint16_t *buckets, uint8_t bucket_count, timing_histogram_stats_t *stats) {
+    memset(stats, 0, sizeof(timing_histogram_stats_t));
+    if (hist->count == 0) {
+        return;
+    }
+
+    stats->count = hist->count;
+    stats->min   = hist->min;
+    stats->max   = hist->max;
+    stats->mean  = (uint32_t)(hist->sum / hist->count);
+    stats->p50   = percentile(hist, buckets, bucket_count, 50);
+    stats->p99   = percentile(hist, buckets, bucket_count, 99);
+}
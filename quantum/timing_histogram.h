@@ -0,0 +1,43 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+    Fixed-size logarithmic histogram of durations, used by the scan profiler and the latency tracer.
+
+    Buckets 0 and 1 hold exact values, after that there are two buckets per power of two:
+    2, 3, 4-5, 6-7, 8-11, 12-15, 16-23, 24-31, ... Values beyond the last bucket are accumulated in it.
+    When a bucket would overflow, all buckets are halved, so long-running histograms keep estimating
+    percentiles correctly while count, min, max and mean stay exact.
+    The bucket array is owned by the caller, so that every user can choose its own bucket count.
+*/
+
+typedef struct timing_histogram_t {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+} timing_histogram_t;
+
+typedef struct timing_histogram_stats_t {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t mean;
+    uint32_t p50;
+    uint32_t p99;
+} timing_histogram_stats_t;
+
+/**
+ * @brief Adds a single value to the histogram.
+ */
+void timing_histogram_record(timing_histogram_t *hist, uint16_t *buckets, uint8_t bucket_count, uint32_t value);
+
+/**
+ * @brief Computes summary statistics of the histogram, p50 and p99 being estimated from the buckets.
+ */
+void timing_histogram_get_stats(const timing_histogram_t *hist, const uint16_t *buckets, uint8_t bucket_count, timing_histogram_stats_t *stats);
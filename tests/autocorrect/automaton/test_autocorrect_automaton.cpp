@@ -0,0 +1,127 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using ::testing::_;
+using ::testing::AnyNumber;
+
+static std::vector<std::pair<std::string, std::string>> corrections;
+
+bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    corrections.push_back({typo, correct});
+    return true;
+}
+
+class AutoCorrectAutomaton : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+        corrections.clear();
+        for (uint8_t i = 0; i < 26; i++) {
+            keys.push_back(KeymapKey(0, i % 10, i / 10, KC_A + i));
+        }
+        keys.push_back(KeymapKey(0, 6, 2, KC_SPACE));
+        keys.push_back(KeymapKey(0, 7, 2, KC_BACKSPACE));
+        keys.push_back(KeymapKey(0, 8, 2, KC_ENTER));
+        for (const KeymapKey &key : keys) {
+            add_key(key);
+        }
+    }
+
+    // Taps the keys of `text`, with '<' for backspace and '\n' for enter.
+    void TypeText(const char *text) {
+        for (; *text; text++) {
+            KeymapKey &key = *text == ' ' ? keys[26] : *text == '<' ? keys[27] : *text == '\n' ? keys[28] : keys[*text - 'a'];
+            key.press();
+            run_one_scan_loop();
+            key.release();
+            run_one_scan_loop();
+        }
+    }
+
+    std::vector<KeymapKey> keys;
+};
+
+using Corrections = std::vector<std::pair<std::string, std::string>>;
+
+TEST_F(AutoCorrectAutomaton, CorrectsTypo) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    TypeText("fales");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(corrections, (Corrections{{"fales", "false"}}));
+}
+
+TEST_F(AutoCorrectAutomaton, WordBoundaries) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    TypeText("overture ture looses looseness ");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(corrections, (Corrections{{"ture", "true"}, {"looses", "loses"}}));
+}
+
+TEST_F(AutoCorrectAutomaton, FollowsFailureLinks) {
+    TestDriver driver;
+
+    // "retre" is a dead end for "retrun", the automaton falls back to "re" and finds "retun"
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    TypeText("retretun ffales ouptut");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(corrections, (Corrections{{"retretun", "retreturn"}, {"ffales", "ffalse"}, {"ouptut", "output"}}));
+}
+
+TEST_F(AutoCorrectAutomaton, BackspaceRestoresState) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    TypeText("falq<es cosx<<snt");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(corrections, (Corrections{{"fales", "false"}, {"cosnt", "const"}}));
+}
+
+TEST_F(AutoCorrectAutomaton, TypoAfterLongText) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    TypeText("qqqqqqqqqqqqaccomodate");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(corrections, (Corrections{{"accomodate", "accommodate"}}));
+}
+
+TEST_F(AutoCorrectAutomaton, EnterResetsWordStart) {
+    TestDriver driver;
+
+    // Enter is a word break which can't end a word, so ":the:the:" needs a space before it, its
+    // typo is only reported from the last word break
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    TypeText("\nthier\n the the ");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(corrections, (Corrections{{"thier", "their"}, {"the", "the"}}));
+}
+
+TEST_F(AutoCorrectAutomaton, Disabled) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    autocorrect_disable();
+    TypeText("fales ");
+    autocorrect_enable();
+    TypeText("ouput");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(corrections, (Corrections{{"ouput", "output"}}));
+}
@@ -0,0 +1,233 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+// The default dictionary, from qmk generate-autocorrect-data --flash-image
+static const uint8_t autocorrect_flash_image[3554] = {
+    0x51, 0x41, 0x43, 0x46, 0x01, 0x05, 0x0A, 0x00, 0xE2, 0x0D, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x13, 0x10, 0x00, 0x00, 0x04, 0x6C, 0x00, 0x00, 0x05, 0x7C, 0x00, 0x00, 0x06, 0x84, 0x00, 0x00,
+    0x07, 0x98, 0x00, 0x00, 0x09, 0xA0, 0x00, 0x00, 0x0A, 0xB8, 0x00, 0x00, 0x0B, 0xC4, 0x00, 0x00,
+    0x0C, 0xCC, 0x00, 0x00, 0x0F, 0xD4, 0x00, 0x00, 0x10, 0xE4, 0x00, 0x00, 0x11, 0xEC, 0x00, 0x00,
+    0x12, 0xF4, 0x00, 0x00, 0x13, 0x04, 0x01, 0x00, 0x15, 0x14, 0x01, 0x00, 0x16, 0x1C, 0x01, 0x00,
+    0x17, 0x34, 0x01, 0x00, 0x18, 0x3C, 0x01, 0x00, 0x1A, 0x44, 0x01, 0x00, 0x2C, 0x60, 0x00, 0x00,
+    0x02, 0x10, 0x00, 0x00, 0x0A, 0x4C, 0x01, 0x00, 0x17, 0x54, 0x01, 0x00, 0x03, 0x10, 0x00, 0x00,
+    0x06, 0x60, 0x01, 0x00, 0x13, 0x6C, 0x01, 0x00, 0x14, 0x78, 0x01, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x08, 0x80, 0x01, 0x00, 0x04, 0x10, 0x00, 0x00, 0x04, 0x88, 0x01, 0x00, 0x0B, 0x90, 0x01, 0x00,
+    0x0C, 0x9C, 0x01, 0x00, 0x12, 0xA4, 0x01, 0x00, 0x01, 0x10, 0x00, 0x00, 0x08, 0xB4, 0x01, 0x00,
+    0x05, 0x10, 0x00, 0x00, 0x04, 0xBC, 0x01, 0x00, 0x0C, 0xC8, 0x01, 0x00, 0x0F, 0xD0, 0x01, 0x00,
+    0x12, 0xD8, 0x01, 0x00, 0x15, 0xE0, 0x01, 0x00, 0x02, 0x10, 0x00, 0x00, 0x04, 0xE8, 0x01, 0x00,
+    0x18, 0xF0, 0x01, 0x00, 0x01, 0x10, 0x00, 0x00, 0x08, 0xF8, 0x01, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x11, 0x00, 0x02, 0x00, 0x03, 0x10, 0x00, 0x00, 0x08, 0x10, 0x02, 0x00, 0x0C, 0x18, 0x02, 0x00,
+    0x12, 0x28, 0x02, 0x00, 0x01, 0x10, 0x00, 0x00, 0x04, 0x30, 0x02, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x04, 0x38, 0x02, 0x00, 0x03, 0x10, 0x00, 0x00, 0x06, 0x40, 0x02, 0x00, 0x18, 0x48, 0x02, 0x00,
+    0x19, 0x50, 0x02, 0x00, 0x03, 0x10, 0x00, 0x00, 0x12, 0x58, 0x02, 0x00, 0x15, 0x60, 0x02, 0x00,
+    0x16, 0x68, 0x02, 0x00, 0x01, 0x10, 0x00, 0x00, 0x08, 0x70, 0x02, 0x00, 0x05, 0x10, 0x00, 0x00,
+    0x04, 0x8C, 0x02, 0x00, 0x08, 0x94, 0x02, 0x00, 0x0C, 0x9C, 0x02, 0x00, 0x17, 0xA4, 0x02, 0x00,
+    0x1A, 0xB0, 0x02, 0x00, 0x01, 0x10, 0x00, 0x00, 0x0B, 0xBC, 0x02, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x07, 0xC4, 0x02, 0x00, 0x01, 0x10, 0x00, 0x00, 0x0C, 0xCC, 0x02, 0x00, 0x01, 0xB8, 0x00, 0x00,
+    0x18, 0xD4, 0x02, 0x00, 0x02, 0x34, 0x01, 0x00, 0x0B, 0xDC, 0x02, 0x00, 0x18, 0xE8, 0x02, 0x00,
+    0x02, 0x84, 0x00, 0x00, 0x06, 0xF0, 0x02, 0x00, 0x12, 0xF8, 0x02, 0x00, 0x02, 0x04, 0x01, 0x00,
+    0x04, 0x00, 0x03, 0x00, 0x13, 0x08, 0x03, 0x00, 0x01, 0x10, 0x00, 0x00, 0x18, 0x10, 0x03, 0x00,
+    0x01, 0x10, 0x00, 0x00, 0x06, 0x18, 0x03, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x18, 0x20, 0x03, 0x00,
+    0x02, 0xC4, 0x00, 0x00, 0x08, 0x28, 0x03, 0x00, 0x12, 0x30, 0x03, 0x00, 0x01, 0xCC, 0x00, 0x00,
+    0x08, 0x38, 0x03, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x03, 0x00, 0x11, 0x48, 0x03, 0x00,
+    0x16, 0x54, 0x03, 0x00, 0x01, 0x10, 0x00, 0x00, 0x15, 0x5C, 0x03, 0x00, 0x02, 0x6C, 0x00, 0x00,
+    0x0F, 0x64, 0x03, 0x00, 0x16, 0x6C, 0x03, 0x00, 0x01, 0xCC, 0x00, 0x00, 0x17, 0x74, 0x03, 0x00,
+    0x01, 0xD4, 0x00, 0x00, 0x04, 0x7C, 0x03, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1A, 0x84, 0x03, 0x00,
+    0x01, 0x14, 0x01, 0x00, 0x08, 0x8C, 0x03, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x18, 0x94, 0x03, 0x00,
+    0x01, 0x3C, 0x01, 0x00, 0x04, 0x9C, 0x03, 0x00, 0x01, 0x10, 0x00, 0x00, 0x0C, 0xA4, 0x03, 0x00,
+    0x03, 0xEC, 0x00, 0x00, 0x06, 0xB0, 0x03, 0x00, 0x17, 0xB8, 0x03, 0x00, 0x19, 0xC4, 0x03, 0x00,
+    0x01, 0x10, 0x00, 0x00, 0x11, 0xCC, 0x03, 0x00, 0x03, 0xCC, 0x00, 0x00, 0x04, 0xD4, 0x03, 0x00,
+    0x05, 0xDC, 0x03, 0x00, 0x16, 0xE4, 0x03, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x12, 0xEC, 0x03, 0x00,
+    0x01, 0x6C, 0x00, 0x00, 0x11, 0xF8, 0x03, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x10, 0x00, 0x04, 0x00,
+    0x01, 0x84, 0x00, 0x00, 0x06, 0x08, 0x04, 0x00, 0x01, 0x3C, 0x01, 0x00, 0x13, 0x14, 0x04, 0x00,
+    0x01, 0x10, 0x00, 0x00, 0x08, 0x20, 0x04, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x16, 0x28, 0x04, 0x00,
+    0x01, 0x14, 0x01, 0x00, 0x0C, 0x30, 0x04, 0x00, 0x01, 0x1C, 0x01, 0x00, 0x18, 0x38, 0x04, 0x00,
+    0x06, 0x10, 0x00, 0x00, 0x06, 0x40, 0x04, 0x00, 0x09, 0x48, 0x04, 0x00, 0x0F, 0x50, 0x04, 0x00,
+    0x13, 0x58, 0x04, 0x00, 0x17, 0x60, 0x04, 0x00, 0x18, 0x6C, 0x04, 0x00, 0x01, 0x6C, 0x00, 0x00,
+    0x09, 0x78, 0x04, 0x00, 0x01, 0x10, 0x00, 0x00, 0x13, 0x80, 0x04, 0x00, 0x01, 0xCC, 0x00, 0x00,
+    0x11, 0x88, 0x04, 0x00, 0x02, 0x34, 0x01, 0x00, 0x0C, 0x90, 0x04, 0x00, 0x15, 0x98, 0x04, 0x00,
+    0x02, 0x44, 0x01, 0x00, 0x0C, 0xA0, 0x04, 0x00, 0x17, 0xA8, 0x04, 0x00, 0x01, 0xC4, 0x00, 0x00,
+    0x15, 0xB0, 0x04, 0x00, 0x01, 0x98, 0x00, 0x00, 0x13, 0xB8, 0x04, 0x00, 0x01, 0xCC, 0x00, 0x00,
+    0x07, 0xC0, 0x04, 0x00, 0x01, 0xF0, 0x01, 0x00, 0x04, 0xC8, 0x04, 0x00, 0x02, 0xBC, 0x02, 0x00,
+    0x08, 0xD0, 0x04, 0x00, 0x0C, 0xD8, 0x04, 0x00, 0x01, 0x3C, 0x01, 0x00, 0x15, 0xE0, 0x04, 0x00,
+    0x01, 0x84, 0x00, 0x00, 0x12, 0xE8, 0x04, 0x00, 0x01, 0xA4, 0x01, 0x00, 0x10, 0xF0, 0x04, 0x00,
+    0x01, 0x6C, 0x00, 0x00, 0x15, 0xF8, 0x04, 0x00, 0x01, 0x04, 0x01, 0x00, 0x04, 0x04, 0x05, 0x00,
+    0x01, 0x3C, 0x01, 0x00, 0x0C, 0x0C, 0x05, 0x00, 0x01, 0x84, 0x00, 0x00, 0x18, 0x14, 0x05, 0x00,
+    0x01, 0x3C, 0x01, 0x00, 0x0B, 0x1C, 0x05, 0x00, 0x01, 0xF8, 0x01, 0x00, 0x0C, 0x24, 0x05, 0x00,
+    0x01, 0xF4, 0x00, 0x00, 0x12, 0x2C, 0x05, 0x00, 0x01, 0x10, 0x00, 0x00, 0x0F, 0x34, 0x05, 0x00,
+    0x01, 0xD4, 0x00, 0x00, 0x0F, 0x3C, 0x05, 0x00, 0x02, 0xEC, 0x00, 0x00, 0x06, 0x44, 0x05, 0x00,
+    0x17, 0x4C, 0x05, 0x00, 0x01, 0x1C, 0x01, 0x00, 0x11, 0x54, 0x05, 0x00, 0x01, 0x14, 0x01, 0x00,
+    0x19, 0x5C, 0x05, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x08, 0x64, 0x05, 0x00, 0x01, 0x1C, 0x01, 0x00,
+    0x0F, 0x6C, 0x05, 0x00, 0x01, 0x34, 0x01, 0x00, 0x0F, 0x74, 0x05, 0x00, 0x01, 0x6C, 0x00, 0x00,
+    0x16, 0x7C, 0x05, 0x00, 0x01, 0x44, 0x01, 0x00, 0x04, 0x84, 0x05, 0x00, 0x01, 0x70, 0x02, 0x00,
+    0x14, 0x8C, 0x05, 0x00, 0x01, 0x3C, 0x01, 0x00, 0x15, 0x94, 0x05, 0x00, 0x01, 0x6C, 0x00, 0x00,
+    0x15, 0x9C, 0x05, 0x00, 0x02, 0xCC, 0x00, 0x00, 0x0A, 0xA4, 0x05, 0x00, 0x15, 0xAC, 0x05, 0x00,
+    0x01, 0x84, 0x00, 0x00, 0x0F, 0xB4, 0x05, 0x00, 0x02, 0x34, 0x01, 0x00, 0x08, 0xBC, 0x05, 0x00,
+    0x13, 0xC4, 0x05, 0x00, 0x01, 0x10, 0x00, 0x00, 0x0F, 0xCC, 0x05, 0x00, 0x01, 0xEC, 0x00, 0x00,
+    0x0A, 0xD4, 0x05, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x16, 0xDC, 0x05, 0x00, 0x01, 0x7C, 0x00, 0x00,
+    0x04, 0xE4, 0x05, 0x00, 0x01, 0x1C, 0x01, 0x00, 0x17, 0xEC, 0x05, 0x00, 0x02, 0xF4, 0x00, 0x00,
+    0x16, 0xF4, 0x05, 0x00, 0x18, 0xFC, 0x05, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x08, 0x04, 0x06, 0x00,
+    0x01, 0xE4, 0x00, 0x00, 0x08, 0x0C, 0x06, 0x00, 0x02, 0x84, 0x00, 0x00, 0x04, 0x14, 0x06, 0x00,
+    0x18, 0x1C, 0x06, 0x00, 0x02, 0x04, 0x01, 0x00, 0x17, 0x24, 0x06, 0x00, 0x18, 0x2C, 0x06, 0x00,
+    0x01, 0x10, 0x00, 0x00, 0x15, 0x34, 0x06, 0x00, 0x01, 0x1C, 0x01, 0x00, 0x17, 0x3C, 0x06, 0x00,
+    0x01, 0xCC, 0x00, 0x00, 0x19, 0x44, 0x06, 0x00, 0x01, 0x3C, 0x01, 0x00, 0x08, 0x4C, 0x06, 0x00,
+    0x01, 0x84, 0x00, 0x00, 0x0C, 0x54, 0x06, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x08, 0x5C, 0x06, 0x00,
+    0x01, 0xD4, 0x00, 0x00, 0x08, 0x64, 0x06, 0x00, 0x01, 0x04, 0x01, 0x00, 0x0C, 0x6C, 0x06, 0x00,
+    0x02, 0x34, 0x01, 0x00, 0x15, 0x74, 0x06, 0x00, 0x18, 0x7C, 0x06, 0x00, 0x02, 0x3C, 0x01, 0x00,
+    0x16, 0x84, 0x06, 0x00, 0x17, 0x8C, 0x06, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x17, 0x94, 0x06, 0x00,
+    0x01, 0x04, 0x01, 0x00, 0x08, 0x9C, 0x06, 0x00, 0x01, 0x00, 0x02, 0x00, 0x0A, 0xA4, 0x06, 0x00,
+    0x01, 0xCC, 0x00, 0x00, 0x15, 0xAC, 0x06, 0x00, 0x01, 0x14, 0x01, 0x00, 0x0C, 0xB4, 0x06, 0x00,
+    0x01, 0xCC, 0x02, 0x00, 0x17, 0xBC, 0x06, 0x00, 0x01, 0x34, 0x01, 0x00, 0x0C, 0xC4, 0x06, 0x00,
+    0x01, 0x14, 0x01, 0x00, 0x08, 0xCC, 0x06, 0x00, 0x01, 0x04, 0x01, 0x00, 0x04, 0xD4, 0x06, 0x00,
+    0x01, 0x98, 0x00, 0x00, 0x0B, 0xDC, 0x06, 0x00, 0x01, 0x9C, 0x03, 0x00, 0x0A, 0xE4, 0x06, 0x00,
+    0x01, 0xF8, 0x01, 0x00, 0x2C, 0xEC, 0x06, 0x00, 0x01, 0xCC, 0x00, 0x00, 0x08, 0xF4, 0x06, 0x00,
+    0x01, 0x14, 0x01, 0x00, 0x08, 0x2C, 0x0B, 0x00, 0x01, 0xA4, 0x01, 0x00, 0x10, 0xFC, 0x06, 0x00,
+    0x01, 0xE4, 0x00, 0x00, 0x10, 0x04, 0x07, 0x00, 0x02, 0x14, 0x01, 0x00, 0x08, 0x0C, 0x07, 0x00,
+    0x15, 0x14, 0x07, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x15, 0x1C, 0x07, 0x00, 0x01, 0xCC, 0x00, 0x00,
+    0x15, 0x28, 0x07, 0x00, 0x01, 0x3C, 0x01, 0x00, 0x04, 0x30, 0x07, 0x00, 0x01, 0xC4, 0x00, 0x00,
+    0x0A, 0x38, 0x07, 0x00, 0x01, 0xA4, 0x03, 0x00, 0x09, 0x35, 0x0B, 0x00, 0x01, 0xF4, 0x00, 0x00,
+    0x16, 0x40, 0x07, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x0C, 0x48, 0x07, 0x00, 0x01, 0xD4, 0x00, 0x00,
+    0x08, 0x50, 0x07, 0x00, 0x01, 0x84, 0x00, 0x00, 0x08, 0x58, 0x07, 0x00, 0x01, 0x34, 0x01, 0x00,
+    0x0C, 0x60, 0x07, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x17, 0x3E, 0x0B, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x0C, 0x68, 0x07, 0x00, 0x01, 0x10, 0x02, 0x00, 0x16, 0x47, 0x0B, 0x00, 0x01, 0xD4, 0x00, 0x00,
+    0x08, 0x4F, 0x0B, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x08, 0x70, 0x07, 0x00, 0x01, 0x1C, 0x01, 0x00,
+    0x08, 0x58, 0x0B, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x15, 0x78, 0x07, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x18, 0x80, 0x07, 0x00, 0x01, 0x14, 0x01, 0x00, 0x04, 0x88, 0x07, 0x00, 0x01, 0x14, 0x01, 0x00,
+    0x04, 0x90, 0x07, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x17, 0x98, 0x07, 0x00, 0x01, 0x14, 0x01, 0x00,
+    0x04, 0xA0, 0x07, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x18, 0xA8, 0x07, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x15, 0xB0, 0x07, 0x00, 0x01, 0x04, 0x01, 0x00, 0x18, 0xB8, 0x07, 0x00, 0x01, 0xD4, 0x00, 0x00,
+    0x0C, 0xC0, 0x07, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x0B, 0xC8, 0x07, 0x00, 0x01, 0x1C, 0x01, 0x00,
+    0x0C, 0xD0, 0x07, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x15, 0xD8, 0x07, 0x00, 0x01, 0xA4, 0x02, 0x00,
+    0x11, 0xE0, 0x07, 0x00, 0x01, 0x1C, 0x01, 0x00, 0x08, 0xE8, 0x07, 0x00, 0x01, 0x48, 0x02, 0x00,
+    0x13, 0x62, 0x0B, 0x00, 0x01, 0x10, 0x00, 0x00, 0x09, 0xF0, 0x07, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x16, 0xF8, 0x07, 0x00, 0x01, 0x88, 0x01, 0x00, 0x16, 0x04, 0x08, 0x00, 0x01, 0x3C, 0x01, 0x00,
+    0x15, 0x0C, 0x08, 0x00, 0x01, 0x34, 0x01, 0x00, 0x18, 0x14, 0x08, 0x00, 0x01, 0x3C, 0x01, 0x00,
+    0x17, 0x6B, 0x0B, 0x00, 0x01, 0x14, 0x01, 0x00, 0x0C, 0x1C, 0x08, 0x00, 0x01, 0xA4, 0x02, 0x00,
+    0x0C, 0x24, 0x08, 0x00, 0x01, 0x10, 0x00, 0x00, 0x0C, 0x2C, 0x08, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x07, 0x34, 0x08, 0x00, 0x01, 0x9C, 0x01, 0x00, 0x08, 0x3C, 0x08, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x15, 0x44, 0x08, 0x00, 0x01, 0x10, 0x02, 0x00, 0x19, 0x4C, 0x08, 0x00, 0x01, 0xCC, 0x00, 0x00,
+    0x17, 0x54, 0x08, 0x00, 0x01, 0x14, 0x01, 0x00, 0x18, 0x5C, 0x08, 0x00, 0x01, 0x3C, 0x01, 0x00,
+    0x11, 0x75, 0x0B, 0x00, 0x01, 0x1C, 0x01, 0x00, 0x0F, 0x64, 0x08, 0x00, 0x01, 0x34, 0x01, 0x00,
+    0x15, 0x6C, 0x08, 0x00, 0x01, 0x34, 0x01, 0x00, 0x08, 0x74, 0x08, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x15, 0x7C, 0x08, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x08, 0x84, 0x08, 0x00, 0x01, 0x14, 0x01, 0x00,
+    0x11, 0x8C, 0x08, 0x00, 0x01, 0xCC, 0x00, 0x00, 0x0A, 0x94, 0x08, 0x00, 0x01, 0x34, 0x01, 0x00,
+    0x0B, 0x9C, 0x08, 0x00, 0x01, 0xCC, 0x00, 0x00, 0x06, 0xA4, 0x08, 0x00, 0x01, 0x70, 0x02, 0x00,
+    0x16, 0xAC, 0x08, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x17, 0xB4, 0x08, 0x00, 0x01, 0xC4, 0x00, 0x00,
+    0x17, 0x7D, 0x0B, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x08, 0x85, 0x0B, 0x00, 0x01, 0x60, 0x00, 0x00,
+    0x17, 0xBC, 0x08, 0x00, 0x01, 0x10, 0x00, 0x00, 0x15, 0x8F, 0x0B, 0x00, 0x01, 0xE4, 0x00, 0x00,
+    0x12, 0xC4, 0x08, 0x00, 0x01, 0xE4, 0x00, 0x00, 0x12, 0xCC, 0x08, 0x00, 0x01, 0x70, 0x02, 0x00,
+    0x11, 0xD4, 0x08, 0x00, 0x01, 0x14, 0x01, 0x00, 0x08, 0xDC, 0x08, 0x00, 0x02, 0x14, 0x01, 0x00,
+    0x04, 0xE4, 0x08, 0x00, 0x15, 0xEC, 0x08, 0x00, 0x01, 0x14, 0x01, 0x00, 0x08, 0x98, 0x0B, 0x00,
+    0x01, 0x6C, 0x00, 0x00, 0x16, 0xF4, 0x08, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x17, 0xA4, 0x0B, 0x00,
+    0x01, 0x1C, 0x01, 0x00, 0x08, 0xFC, 0x08, 0x00, 0x01, 0x18, 0x02, 0x00, 0x11, 0x04, 0x09, 0x00,
+    0x01, 0x10, 0x02, 0x00, 0x0A, 0x0C, 0x09, 0x00, 0x01, 0x10, 0x00, 0x00, 0x11, 0x14, 0x09, 0x00,
+    0x01, 0xCC, 0x00, 0x00, 0x04, 0x1C, 0x09, 0x00, 0x01, 0xCC, 0x00, 0x00, 0x08, 0x24, 0x09, 0x00,
+    0x01, 0x10, 0x02, 0x00, 0x15, 0xAD, 0x0B, 0x00, 0x01, 0x14, 0x01, 0x00, 0x07, 0xB7, 0x0B, 0x00,
+    0x01, 0x3C, 0x01, 0x00, 0x08, 0x2C, 0x09, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x11, 0x34, 0x09, 0x00,
+    0x01, 0x6C, 0x00, 0x00, 0x17, 0x3C, 0x09, 0x00, 0x01, 0x34, 0x01, 0x00, 0x0B, 0xC2, 0x0B, 0x00,
+    0x01, 0x6C, 0x00, 0x00, 0x15, 0x44, 0x09, 0x00, 0x01, 0x3C, 0x01, 0x00, 0x08, 0x4C, 0x09, 0x00,
+    0x01, 0x14, 0x01, 0x00, 0x04, 0x54, 0x09, 0x00, 0x01, 0x3C, 0x01, 0x00, 0x17, 0xCA, 0x0B, 0x00,
+    0x01, 0x18, 0x02, 0x00, 0x04, 0x5C, 0x09, 0x00, 0x01, 0xC4, 0x00, 0x00, 0x17, 0xD3, 0x0B, 0x00,
+    0x01, 0x9C, 0x02, 0x00, 0x12, 0x64, 0x09, 0x00, 0x01, 0x14, 0x01, 0x00, 0x1C, 0xDB, 0x0B, 0x00,
+    0x01, 0xEC, 0x00, 0x00, 0x08, 0x6C, 0x09, 0x00, 0x01, 0x94, 0x02, 0x00, 0x16, 0x74, 0x09, 0x00,
+    0x01, 0xA0, 0x00, 0x00, 0x0C, 0x7C, 0x09, 0x00, 0x02, 0x1C, 0x01, 0x00, 0x04, 0x84, 0x09, 0x00,
+    0x13, 0x8C, 0x09, 0x00, 0x01, 0x1C, 0x01, 0x00, 0x16, 0x94, 0x09, 0x00, 0x01, 0x14, 0x01, 0x00,
+    0x08, 0x9C, 0x09, 0x00, 0x01, 0x3C, 0x01, 0x00, 0x17, 0xE5, 0x0B, 0x00, 0x01, 0xCC, 0x00, 0x00,
+    0x07, 0xA4, 0x09, 0x00, 0x01, 0x90, 0x04, 0x00, 0x12, 0xAC, 0x09, 0x00, 0x01, 0xCC, 0x00, 0x00,
+    0x0F, 0xB4, 0x09, 0x00, 0x01, 0x98, 0x00, 0x00, 0x12, 0xEF, 0x0B, 0x00, 0x01, 0x38, 0x03, 0x00,
+    0x19, 0xBC, 0x09, 0x00, 0x01, 0x14, 0x01, 0x00, 0x08, 0xC4, 0x09, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x08, 0xCC, 0x09, 0x00, 0x01, 0x34, 0x01, 0x00, 0x0C, 0xD4, 0x09, 0x00, 0x01, 0x3C, 0x01, 0x00,
+    0x11, 0xF9, 0x0B, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x17, 0x02, 0x0C, 0x00, 0x01, 0x14, 0x01, 0x00,
+    0x11, 0x0C, 0x0C, 0x00, 0x01, 0x10, 0x00, 0x00, 0x1C, 0x16, 0x0C, 0x00, 0x01, 0x14, 0x01, 0x00,
+    0x04, 0xDC, 0x09, 0x00, 0x01, 0x10, 0x00, 0x00, 0x07, 0x1F, 0x0C, 0x00, 0x01, 0xEC, 0x00, 0x00,
+    0x0A, 0x29, 0x0C, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x11, 0x33, 0x0C, 0x00, 0x01, 0xBC, 0x02, 0x00,
+    0x06, 0x3B, 0x0C, 0x00, 0x01, 0x84, 0x00, 0x00, 0x0B, 0x43, 0x0C, 0x00, 0x01, 0x1C, 0x01, 0x00,
+    0x12, 0xE4, 0x09, 0x00, 0x01, 0x34, 0x01, 0x00, 0x08, 0x4D, 0x0C, 0x00, 0x01, 0x54, 0x01, 0x00,
+    0x0B, 0xEC, 0x09, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xF4, 0x09, 0x00, 0x01, 0xF4, 0x00, 0x00,
+    0x07, 0xFC, 0x09, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x17, 0x58, 0x0C, 0x00, 0x01, 0x70, 0x02, 0x00,
+    0x11, 0x04, 0x0A, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x11, 0x0C, 0x0A, 0x00, 0x01, 0x14, 0x01, 0x00,
+    0x08, 0x14, 0x0A, 0x00, 0x01, 0x1C, 0x01, 0x00, 0x08, 0x64, 0x0C, 0x00, 0x01, 0x94, 0x02, 0x00,
+    0x11, 0x6E, 0x0C, 0x00, 0x01, 0x00, 0x02, 0x00, 0x0A, 0x77, 0x0C, 0x00, 0x01, 0xB8, 0x00, 0x00,
+    0x18, 0x1C, 0x0A, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x16, 0x24, 0x0A, 0x00, 0x01, 0x6C, 0x00, 0x00,
+    0x11, 0x2C, 0x0A, 0x00, 0x01, 0x10, 0x00, 0x00, 0x07, 0x83, 0x0C, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x06, 0x34, 0x0A, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x17, 0x3C, 0x0A, 0x00, 0x01, 0x34, 0x01, 0x00,
+    0x08, 0x44, 0x0A, 0x00, 0x01, 0x14, 0x01, 0x00, 0x06, 0x4C, 0x0A, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x07, 0x8D, 0x0C, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x17, 0x54, 0x0A, 0x00, 0x01, 0xD4, 0x03, 0x00,
+    0x07, 0x95, 0x0C, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x11, 0x9F, 0x0C, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x15, 0xA9, 0x0C, 0x00, 0x01, 0x1C, 0x01, 0x00, 0x2C, 0xB3, 0x0C, 0x00, 0x01, 0xC8, 0x01, 0x00,
+    0x16, 0x5C, 0x0A, 0x00, 0x01, 0x8C, 0x02, 0x00, 0x13, 0x64, 0x0A, 0x00, 0x01, 0x04, 0x01, 0x00,
+    0x06, 0x6C, 0x0A, 0x00, 0x01, 0x1C, 0x01, 0x00, 0x0C, 0x74, 0x0A, 0x00, 0x01, 0x70, 0x02, 0x00,
+    0x07, 0xBC, 0x0C, 0x00, 0x01, 0x98, 0x00, 0x00, 0x08, 0xC5, 0x0C, 0x00, 0x01, 0xF4, 0x00, 0x00,
+    0x11, 0xCF, 0x0C, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x08, 0x7C, 0x0A, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x08, 0xDA, 0x0C, 0x00, 0x01, 0x70, 0x02, 0x00, 0x07, 0xE4, 0x0C, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x11, 0x84, 0x0A, 0x00, 0x01, 0xCC, 0x00, 0x00, 0x17, 0x8C, 0x0A, 0x00, 0x01, 0x6C, 0x00, 0x00,
+    0x17, 0x94, 0x0A, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0x9C, 0x0A, 0x00, 0x01, 0xDC, 0x02, 0x00,
+    0x08, 0xA4, 0x0A, 0x00, 0x01, 0x98, 0x00, 0x00, 0x04, 0xAC, 0x0A, 0x00, 0x01, 0x98, 0x00, 0x00,
+    0x04, 0xB4, 0x0A, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x17, 0xED, 0x0C, 0x00, 0x01, 0xEC, 0x00, 0x00,
+    0x17, 0xF9, 0x0C, 0x00, 0x01, 0x70, 0x02, 0x00, 0x11, 0xBC, 0x0A, 0x00, 0x01, 0xF0, 0x01, 0x00,
+    0x08, 0x02, 0x0D, 0x00, 0x01, 0x1C, 0x01, 0x00, 0x18, 0xC4, 0x0A, 0x00, 0x01, 0xEC, 0x00, 0x00,
+    0x16, 0x0C, 0x0D, 0x00, 0x01, 0x84, 0x00, 0x00, 0x1C, 0x16, 0x0D, 0x00, 0x01, 0x34, 0x01, 0x00,
+    0x08, 0xCC, 0x0A, 0x00, 0x01, 0x10, 0x00, 0x00, 0x08, 0x1F, 0x0D, 0x00, 0x01, 0x84, 0x00, 0x00,
+    0x0B, 0xD4, 0x0A, 0x00, 0x01, 0x34, 0x01, 0x00, 0x12, 0xDC, 0x0A, 0x00, 0x01, 0x1C, 0x01, 0x00,
+    0x17, 0x29, 0x0D, 0x00, 0x01, 0x6C, 0x01, 0x00, 0x06, 0xE4, 0x0A, 0x00, 0x01, 0x84, 0x00, 0x00,
+    0x04, 0xEC, 0x0A, 0x00, 0x01, 0x9C, 0x02, 0x00, 0x12, 0xF4, 0x0A, 0x00, 0x01, 0x10, 0x02, 0x00,
+    0x07, 0xFC, 0x0A, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x17, 0x34, 0x0D, 0x00, 0x01, 0x34, 0x01, 0x00,
+    0x0C, 0x04, 0x0B, 0x00, 0x01, 0x34, 0x01, 0x00, 0x08, 0x3D, 0x0D, 0x00, 0x01, 0xD4, 0x00, 0x00,
+    0x07, 0x48, 0x0D, 0x00, 0x01, 0xD0, 0x04, 0x00, 0x2C, 0x52, 0x0D, 0x00, 0x01, 0x6C, 0x00, 0x00,
+    0x17, 0x0C, 0x0B, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x17, 0x14, 0x0B, 0x00, 0x01, 0xEC, 0x00, 0x00,
+    0x17, 0x58, 0x0D, 0x00, 0x01, 0x3C, 0x01, 0x00, 0x16, 0x61, 0x0D, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x08, 0x6D, 0x0D, 0x00, 0x01, 0x90, 0x01, 0x00, 0x1C, 0x7B, 0x0D, 0x00, 0x01, 0xF4, 0x00, 0x00,
+    0x15, 0x89, 0x0D, 0x00, 0x01, 0x84, 0x00, 0x00, 0x08, 0x96, 0x0D, 0x00, 0x01, 0x88, 0x01, 0x00,
+    0x08, 0xA0, 0x0D, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x11, 0xA9, 0x0D, 0x00, 0x01, 0x98, 0x00, 0x00,
+    0x0A, 0x1C, 0x0B, 0x00, 0x01, 0xCC, 0x00, 0x00, 0x12, 0x24, 0x0B, 0x00, 0x01, 0x34, 0x01, 0x00,
+    0x08, 0xB2, 0x0D, 0x00, 0x01, 0x34, 0x01, 0x00, 0x08, 0xBE, 0x0D, 0x00, 0x01, 0xB8, 0x00, 0x00,
+    0x08, 0xCD, 0x0D, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x11, 0xD5, 0x0D, 0x00, 0x80, 0x70, 0x02, 0x00,
+    0x82, 0x72, 0x75, 0x65, 0x00, 0x80, 0xA0, 0x00, 0x00, 0x82, 0x69, 0x65, 0x66, 0x00, 0x80, 0x34,
+    0x01, 0x00, 0x82, 0x6E, 0x73, 0x74, 0x00, 0x80, 0x1C, 0x01, 0x00, 0x81, 0x73, 0x65, 0x00, 0x80,
+    0x10, 0x02, 0x00, 0x82, 0x6C, 0x73, 0x65, 0x00, 0x80, 0x94, 0x02, 0x00, 0x83, 0x61, 0x6C, 0x73,
+    0x65, 0x00, 0x80, 0x14, 0x04, 0x00, 0x81, 0x6B, 0x75, 0x70, 0x00, 0x80, 0x34, 0x01, 0x00, 0x82,
+    0x74, 0x70, 0x75, 0x74, 0x00, 0x80, 0xEC, 0x00, 0x00, 0x80, 0x72, 0x6E, 0x00, 0x80, 0x34, 0x01,
+    0x00, 0x81, 0x74, 0x68, 0x00, 0x80, 0x10, 0x00, 0x00, 0x83, 0x61, 0x75, 0x67, 0x65, 0x00, 0x80,
+    0x14, 0x01, 0x00, 0x82, 0x65, 0x69, 0x72, 0x00, 0x80, 0x70, 0x02, 0x00, 0x84, 0x63, 0x71, 0x75,
+    0x69, 0x72, 0x65, 0x00, 0x80, 0x34, 0x01, 0x00, 0x82, 0x67, 0x68, 0x74, 0x00, 0x80, 0x14, 0x01,
+    0x00, 0x83, 0x6C, 0x74, 0x65, 0x72, 0x00, 0x80, 0x98, 0x00, 0x00, 0x83, 0x72, 0x77, 0x61, 0x72,
+    0x64, 0x00, 0x80, 0xBC, 0x02, 0x00, 0x81, 0x68, 0x74, 0x00, 0x80, 0x34, 0x01, 0x00, 0x83, 0x70,
+    0x75, 0x74, 0x00, 0x80, 0x34, 0x01, 0x00, 0x81, 0x74, 0x68, 0x00, 0x80, 0x10, 0x00, 0x00, 0x82,
+    0x72, 0x61, 0x72, 0x79, 0x00, 0x80, 0x34, 0x01, 0x00, 0x83, 0x74, 0x70, 0x75, 0x74, 0x00, 0x80,
+    0xF4, 0x00, 0x00, 0x83, 0x65, 0x75, 0x64, 0x6F, 0x00, 0x80, 0xEC, 0x00, 0x00, 0x82, 0x75, 0x72,
+    0x6E, 0x00, 0x80, 0x34, 0x01, 0x00, 0x83, 0x73, 0x75, 0x6C, 0x74, 0x00, 0x80, 0xEC, 0x00, 0x00,
+    0x83, 0x74, 0x75, 0x72, 0x6E, 0x00, 0x80, 0x10, 0x00, 0x00, 0x82, 0x65, 0x74, 0x79, 0x00, 0x80,
+    0x98, 0x00, 0x00, 0x83, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x80, 0xB8, 0x00, 0x00, 0x83, 0x72, 0x69,
+    0x6E, 0x67, 0x00, 0x80, 0xEC, 0x00, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x80, 0x84, 0x00, 0x00, 0x81,
+    0x63, 0x68, 0x00, 0x80, 0x90, 0x01, 0x00, 0x83, 0x69, 0x74, 0x63, 0x68, 0x00, 0x80, 0x10, 0x00,
+    0x00, 0x84, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00, 0x80, 0x34, 0x01, 0x00, 0x84, 0x70, 0x61, 0x72,
+    0x65, 0x6E, 0x74, 0x00, 0x80, 0x94, 0x02, 0x00, 0x83, 0x61, 0x75, 0x73, 0x65, 0x00, 0x80, 0xEC,
+    0x00, 0x00, 0x83, 0x73, 0x65, 0x6E, 0x00, 0x80, 0xB8, 0x00, 0x00, 0x85, 0x65, 0x69, 0x6C, 0x69,
+    0x6E, 0x67, 0x00, 0x80, 0x98, 0x00, 0x00, 0x83, 0x69, 0x76, 0x65, 0x64, 0x00, 0x80, 0x98, 0x00,
+    0x00, 0x81, 0x64, 0x65, 0x00, 0x80, 0x98, 0x00, 0x00, 0x83, 0x61, 0x6C, 0x69, 0x64, 0x00, 0x80,
+    0xEC, 0x00, 0x00, 0x83, 0x69, 0x73, 0x6F, 0x6E, 0x00, 0x80, 0x14, 0x01, 0x00, 0x82, 0x65, 0x6E,
+    0x65, 0x72, 0x00, 0x80, 0x60, 0x00, 0x00, 0x84, 0x73, 0x65, 0x73, 0x00, 0x80, 0x98, 0x00, 0x00,
+    0x81, 0x72, 0x65, 0x64, 0x00, 0x80, 0xB4, 0x01, 0x00, 0x82, 0x72, 0x69, 0x64, 0x65, 0x00, 0x80,
+    0xEC, 0x00, 0x00, 0x83, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x80, 0x10, 0x00, 0x00, 0x83, 0x65,
+    0x69, 0x76, 0x65, 0x00, 0x80, 0x98, 0x00, 0x00, 0x81, 0x72, 0x65, 0x64, 0x00, 0x80, 0x34, 0x01,
+    0x00, 0x85, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x80, 0x34, 0x01, 0x00, 0x82, 0x65, 0x6E,
+    0x74, 0x00, 0x80, 0x10, 0x00, 0x00, 0x82, 0x61, 0x67, 0x75, 0x65, 0x00, 0x80, 0x1C, 0x01, 0x00,
+    0x83, 0x61, 0x69, 0x6E, 0x73, 0x00, 0x80, 0x10, 0x00, 0x00, 0x81, 0x6E, 0x63, 0x79, 0x00, 0x80,
+    0x10, 0x00, 0x00, 0x82, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x80, 0xA4, 0x02, 0x00, 0x84, 0x69, 0x66,
+    0x65, 0x73, 0x74, 0x00, 0x80, 0x34, 0x01, 0x00, 0x82, 0x61, 0x6E, 0x74, 0x00, 0x80, 0x10, 0x00,
+    0x00, 0x84, 0x61, 0x72, 0x61, 0x74, 0x65, 0x00, 0x80, 0x98, 0x00, 0x00, 0x82, 0x68, 0x6F, 0x6C,
+    0x64, 0x00, 0x80, 0xEC, 0x06, 0x00, 0x84, 0x00, 0x80, 0x34, 0x01, 0x00, 0x83, 0x65, 0x6E, 0x74,
+    0x00, 0x80, 0x1C, 0x01, 0x00, 0x85, 0x73, 0x65, 0x6E, 0x73, 0x75, 0x73, 0x00, 0x80, 0x10, 0x00,
+    0x00, 0x87, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x80, 0x10, 0x00, 0x00, 0x87,
+    0x69, 0x65, 0x72, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00, 0x80, 0x14, 0x01, 0x00, 0x87, 0x74, 0x65,
+    0x72, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x80, 0x10, 0x00, 0x00, 0x83, 0x70, 0x61, 0x63, 0x65, 0x00,
+    0x80, 0x10, 0x00, 0x00, 0x82, 0x61, 0x63, 0x65, 0x00, 0x80, 0xEC, 0x00, 0x00, 0x83, 0x69, 0x6F,
+    0x6E, 0x00, 0x80, 0x10, 0x00, 0x00, 0x84, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x80, 0x10,
+    0x00, 0x00, 0x87, 0x63, 0x6F, 0x6D, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x80, 0x10, 0x00,
+    0x00, 0x82, 0x67, 0x65, 0x00, 0x80, 0xEC, 0x00, 0x00, 0x86, 0x65, 0x74, 0x69, 0x74, 0x69, 0x6F,
+    0x6E, 0x00,
+};
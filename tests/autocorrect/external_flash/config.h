@@ -0,0 +1,14 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define AUTOCORRECT_EXTERNAL_FLASH
+#define EXTERNAL_FLASH_SPI_SLAVE_SELECT_PIN 0
+#define AUTOCORRECT_EXTERNAL_FLASH_ADDRESS 4096
+
+// Much smaller than the image, so that pages get replaced
+#define AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGES 4
+#define AUTOCORRECT_EXTERNAL_FLASH_CACHE_PAGE_SIZE 32
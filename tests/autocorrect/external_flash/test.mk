@@ -0,0 +1,11 @@
+# Copyright 2023 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+AUTOCORRECT_ENABLE = yes
+
+# flash_read_block() is faked by the test, only the driver header is needed
+VPATH += $(DRIVER_PATH)/flash
@@ -0,0 +1,170 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "autocorrect_flash_image.h"
+
+extern "C" {
+#include "flash_spi.h"
+}
+
+using ::testing::_;
+using ::testing::AnyNumber;
+
+static std::vector<uint8_t>                             flash;
+static bool                                             flash_fails;
+static int                                              flash_reads;
+static std::vector<std::pair<std::string, std::string>> corrections;
+
+extern "C" {
+void flash_init(void) {}
+
+flash_status_t flash_read_block(uint32_t addr, void *buf, size_t len) {
+    if (flash_fails || addr + len > flash.size()) {
+        return FLASH_STATUS_ERROR;
+    }
+    flash_reads++;
+    memcpy(buf, flash.data() + addr, len);
+    return FLASH_STATUS_SUCCESS;
+}
+}
+
+bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    corrections.push_back({typo, correct});
+    return true;
+}
+
+using Corrections = std::vector<std::pair<std::string, std::string>>;
+
+class AutoCorrectExternalFlash : public TestFixture {
+   public:
+    void SetUp() override {
+        // Erased flash, with the image at AUTOCORRECT_EXTERNAL_FLASH_ADDRESS
+        flash.assign(64 * 1024, 0xFF);
+        memcpy(flash.data() + AUTOCORRECT_EXTERNAL_FLASH_ADDRESS, autocorrect_flash_image, sizeof(autocorrect_flash_image));
+        flash_fails = false;
+        flash_reads = 0;
+        autocorrect_external_flash_reload();
+        autocorrect_enable();
+
+        corrections.clear();
+        for (uint8_t i = 0; i < 26; i++) {
+            keys.push_back(KeymapKey(0, i % 10, i / 10, KC_A + i));
+        }
+        keys.push_back(KeymapKey(0, 6, 2, KC_SPACE));
+        keys.push_back(KeymapKey(0, 7, 2, KC_BACKSPACE));
+        for (const KeymapKey &key : keys) {
+            add_key(key);
+        }
+    }
+
+    // Taps the keys of `text`, with '<' for backspace.
+    void TypeText(const char *text) {
+        for (; *text; text++) {
+            KeymapKey &key = *text == ' ' ? keys[26] : *text == '<' ? keys[27] : keys[*text - 'a'];
+            key.press();
+            run_one_scan_loop();
+            key.release();
+            run_one_scan_loop();
+        }
+    }
+
+    std::vector<KeymapKey> keys;
+};
+
+TEST_F(AutoCorrectExternalFlash, CorrectsTypos) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    TypeText("fales retretun overture ture looses ");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(corrections, (Corrections{{"fales", "false"}, {"retretun", "retreturn"}, {"ture", "true"}, {"looses", "loses"}}));
+}
+
+TEST_F(AutoCorrectExternalFlash, BackspaceRestoresState) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    TypeText("falq<es cosx<<snt");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(corrections, (Corrections{{"fales", "false"}, {"cosnt", "const"}}));
+}
+
+TEST_F(AutoCorrectExternalFlash, CachedStatesDoNotReadFlash) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    TypeText("q");
+    int reads = flash_reads;
+    TypeText("qqqqqqqqqqqqqqqqqqqq");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(reads, 0);
+    EXPECT_EQ(flash_reads, reads);
+}
+
+TEST_F(AutoCorrectExternalFlash, MissingImage) {
+    TestDriver driver;
+
+    std::fill(flash.begin(), flash.end(), 0xFF);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    TypeText("fales ");
+    VERIFY_AND_CLEAR(driver);
+
+    // Only the header is read, once
+    EXPECT_TRUE(corrections.empty());
+    EXPECT_EQ(flash_reads, 1);
+}
+
+TEST_F(AutoCorrectExternalFlash, InvalidHeader) {
+    TestDriver driver;
+
+    // An unknown version, with what would be a typo completing state at the root
+    flash[AUTOCORRECT_EXTERNAL_FLASH_ADDRESS + 4]  = 2;
+    flash[AUTOCORRECT_EXTERNAL_FLASH_ADDRESS + 16] = 0x80;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    TypeText("fales ");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TRUE(corrections.empty());
+    EXPECT_EQ(flash_reads, 1);
+}
+
+TEST_F(AutoCorrectExternalFlash, TyposLongerThanMaxLength) {
+    TestDriver driver;
+
+    flash[AUTOCORRECT_EXTERNAL_FLASH_ADDRESS + 6] = AUTOCORRECT_MAX_LENGTH + 1;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    TypeText("fales ");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TRUE(corrections.empty());
+}
+
+TEST_F(AutoCorrectExternalFlash, ReloadAfterReadFailure) {
+    TestDriver driver;
+
+    flash_fails = true;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    TypeText("fales ");
+    EXPECT_TRUE(corrections.empty());
+
+    flash_fails = false;
+    autocorrect_external_flash_reload();
+    TypeText("fales ");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(corrections, (Corrections{{"fales", "false"}}));
+}
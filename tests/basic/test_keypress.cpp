@@ -76,6 +76,61 @@ TEST_F(KeyPress, CorrectKeysAreReportedWhenTwoKeysArePressed) {
     keyboard_task();
 }
 
+TEST_F(KeyPress, SeventhKeyIsNotReported) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+    auto       key_d = KeymapKey(0, 3, 0, KC_D);
+    auto       key_e = KeymapKey(0, 4, 0, KC_E);
+    auto       key_f = KeymapKey(0, 5, 0, KC_F);
+    auto       key_g = KeymapKey(0, 6, 0, KC_G);
+
+    set_keymap({key_a, key_b, key_c, key_d, key_e, key_f, key_g});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D, KC_E));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D, KC_E, KC_F));
+    for (auto key : {key_a, key_b, key_c, key_d, key_e, key_f}) {
+        key.press();
+        run_one_scan_loop();
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    // The report is full, so neither pressing nor releasing the seventh key changes it
+    EXPECT_NO_REPORT(driver);
+    key_g.press();
+    run_one_scan_loop();
+    key_g.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B, KC_C, KC_D, KC_E, KC_F));
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B, KC_C, KC_D, KC_E, KC_F, KC_G));
+    key_g.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_C, KC_D, KC_E, KC_F, KC_G));
+    EXPECT_REPORT(driver, (KC_D, KC_E, KC_F, KC_G));
+    EXPECT_REPORT(driver, (KC_E, KC_F, KC_G));
+    EXPECT_REPORT(driver, (KC_F, KC_G));
+    EXPECT_REPORT(driver, (KC_G));
+    EXPECT_EMPTY_REPORT(driver);
+    for (auto key : {key_b, key_c, key_d, key_e, key_f, key_g}) {
+        key.release();
+        run_one_scan_loop();
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
 TEST_F(KeyPress, LeftShiftIsReportedCorrectly) {
     TestDriver driver;
     auto       key_a    = KeymapKey(0, 0, 0, KC_A);
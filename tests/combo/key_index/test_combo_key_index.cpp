@@ -0,0 +1,129 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+#include "process_combo.h"
+}
+
+using testing::_;
+
+static std::vector<std::pair<uint16_t, bool>> combo_events;
+
+void process_combo_event(uint16_t combo_index, bool pressed) {
+    combo_events.push_back({combo_index, pressed});
+}
+
+// Finds the combo made of exactly the given keycodes
+static uint16_t combo_index_of(const std::vector<uint16_t> &keycodes) {
+    for (uint16_t index = 0; index < combo_count(); index++) {
+        const uint16_t *keys = combo_get(index)->keys;
+        size_t          n    = 0;
+        while (keys[n] != COMBO_END && n < keycodes.size() && keys[n] == keycodes[n]) {
+            n++;
+        }
+        if (n == keycodes.size() && keys[n] == COMBO_END) {
+            return index;
+        }
+    }
+    ADD_FAILURE() << "no such combo";
+    return -1;
+}
+
+class ComboKeyIndex : public TestFixture {
+   public:
+    void SetUp() override {
+        combo_events.clear();
+        for (uint8_t i = 0; i < 20; i++) {
+            keys.push_back(KeymapKey(0, i % 10, i / 10, KC_A + i));
+        }
+        keys.push_back(KeymapKey(0, 0, 2, KC_Z));
+        for (const KeymapKey &key : keys) {
+            add_key(key);
+        }
+    }
+
+    std::vector<KeymapKey> keys;
+};
+
+TEST_F(ComboKeyIndex, EveryPairComboFires) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    for (uint8_t i = 0; i < 20; i++) {
+        for (uint8_t j = i + 1; j < 20; j++) {
+            combo_events.clear();
+            tap_combo({keys[i], keys[j]});
+
+            uint16_t index = combo_index_of({(uint16_t)(KC_A + i), (uint16_t)(KC_A + j)});
+            ASSERT_EQ(combo_events.size(), 2) << "combo " << index;
+            EXPECT_EQ(combo_events[0], std::make_pair(index, true));
+            EXPECT_EQ(combo_events[1], std::make_pair(index, false));
+        }
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeyIndex, LongestOverlappingComboWins) {
+    TestDriver driver;
+
+    // C, D and E complete CD, CE, DE and CDE, only the three key combo fires
+    EXPECT_NO_REPORT(driver);
+    tap_combo({keys[2], keys[3], keys[4]});
+    VERIFY_AND_CLEAR(driver);
+
+    uint16_t index = combo_index_of({KC_C, KC_D, KC_E});
+    ASSERT_EQ(combo_events.size(), 2);
+    EXPECT_EQ(combo_events[0], std::make_pair(index, true));
+    EXPECT_EQ(combo_events[1], std::make_pair(index, false));
+}
+
+TEST_F(ComboKeyIndex, KeyOutsideOfCombosIsNotDelayed) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_Z));
+    keys[20].press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    keys[20].release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TRUE(combo_events.empty());
+}
+
+TEST_F(ComboKeyIndex, ComboAfterInterruptedChord) {
+    TestDriver driver;
+
+    // A lone combo key is sent once released, and leaves no state behind in its combos
+    EXPECT_NO_REPORT(driver);
+    keys[7].press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_H));
+    EXPECT_EMPTY_REPORT(driver);
+    keys[7].release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    tap_combo({keys[7], keys[19]});
+    VERIFY_AND_CLEAR(driver);
+
+    uint16_t index = combo_index_of({KC_H, KC_T});
+    ASSERT_EQ(combo_events.size(), 2);
+    EXPECT_EQ(combo_events[0], std::make_pair(index, true));
+    EXPECT_EQ(combo_events[1], std::make_pair(index, false));
+}
@@ -0,0 +1,433 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+/*
+ * A large, steno-like combo set: a combo for every pair of the keys A to T,
+ * followed by a combo for every three consecutive keys of that range. Every
+ * key belongs to 20 to 22 combos, and every three consecutive keys also
+ * complete three overlapping two key combos.
+ */
+
+// clang-format off
+uint16_t const combo_ab[] = {KC_A, KC_B, COMBO_END};
+uint16_t const combo_ac[] = {KC_A, KC_C, COMBO_END};
+uint16_t const combo_ad[] = {KC_A, KC_D, COMBO_END};
+uint16_t const combo_ae[] = {KC_A, KC_E, COMBO_END};
+uint16_t const combo_af[] = {KC_A, KC_F, COMBO_END};
+uint16_t const combo_ag[] = {KC_A, KC_G, COMBO_END};
+uint16_t const combo_ah[] = {KC_A, KC_H, COMBO_END};
+uint16_t const combo_ai[] = {KC_A, KC_I, COMBO_END};
+uint16_t const combo_aj[] = {KC_A, KC_J, COMBO_END};
+uint16_t const combo_ak[] = {KC_A, KC_K, COMBO_END};
+uint16_t const combo_al[] = {KC_A, KC_L, COMBO_END};
+uint16_t const combo_am[] = {KC_A, KC_M, COMBO_END};
+uint16_t const combo_an[] = {KC_A, KC_N, COMBO_END};
+uint16_t const combo_ao[] = {KC_A, KC_O, COMBO_END};
+uint16_t const combo_ap[] = {KC_A, KC_P, COMBO_END};
+uint16_t const combo_aq[] = {KC_A, KC_Q, COMBO_END};
+uint16_t const combo_ar[] = {KC_A, KC_R, COMBO_END};
+uint16_t const combo_as[] = {KC_A, KC_S, COMBO_END};
+uint16_t const combo_at[] = {KC_A, KC_T, COMBO_END};
+uint16_t const combo_bc[] = {KC_B, KC_C, COMBO_END};
+uint16_t const combo_bd[] = {KC_B, KC_D, COMBO_END};
+uint16_t const combo_be[] = {KC_B, KC_E, COMBO_END};
+uint16_t const combo_bf[] = {KC_B, KC_F, COMBO_END};
+uint16_t const combo_bg[] = {KC_B, KC_G, COMBO_END};
+uint16_t const combo_bh[] = {KC_B, KC_H, COMBO_END};
+uint16_t const combo_bi[] = {KC_B, KC_I, COMBO_END};
+uint16_t const combo_bj[] = {KC_B, KC_J, COMBO_END};
+uint16_t const combo_bk[] = {KC_B, KC_K, COMBO_END};
+uint16_t const combo_bl[] = {KC_B, KC_L, COMBO_END};
+uint16_t const combo_bm[] = {KC_B, KC_M, COMBO_END};
+uint16_t const combo_bn[] = {KC_B, KC_N, COMBO_END};
+uint16_t const combo_bo[] = {KC_B, KC_O, COMBO_END};
+uint16_t const combo_bp[] = {KC_B, KC_P, COMBO_END};
+uint16_t const combo_bq[] = {KC_B, KC_Q, COMBO_END};
+uint16_t const combo_br[] = {KC_B, KC_R, COMBO_END};
+uint16_t const combo_bs[] = {KC_B, KC_S, COMBO_END};
+uint16_t const combo_bt[] = {KC_B, KC_T, COMBO_END};
+uint16_t const combo_cd[] = {KC_C, KC_D, COMBO_END};
+uint16_t const combo_ce[] = {KC_C, KC_E, COMBO_END};
+uint16_t const combo_cf[] = {KC_C, KC_F, COMBO_END};
+uint16_t const combo_cg[] = {KC_C, KC_G, COMBO_END};
+uint16_t const combo_ch[] = {KC_C, KC_H, COMBO_END};
+uint16_t const combo_ci[] = {KC_C, KC_I, COMBO_END};
+uint16_t const combo_cj[] = {KC_C, KC_J, COMBO_END};
+uint16_t const combo_ck[] = {KC_C, KC_K, COMBO_END};
+uint16_t const combo_cl[] = {KC_C, KC_L, COMBO_END};
+uint16_t const combo_cm[] = {KC_C, KC_M, COMBO_END};
+uint16_t const combo_cn[] = {KC_C, KC_N, COMBO_END};
+uint16_t const combo_co[] = {KC_C, KC_O, COMBO_END};
+uint16_t const combo_cp[] = {KC_C, KC_P, COMBO_END};
+uint16_t const combo_cq[] = {KC_C, KC_Q, COMBO_END};
+uint16_t const combo_cr[] = {KC_C, KC_R, COMBO_END};
+uint16_t const combo_cs[] = {KC_C, KC_S, COMBO_END};
+uint16_t const combo_ct[] = {KC_C, KC_T, COMBO_END};
+uint16_t const combo_de[] = {KC_D, KC_E, COMBO_END};
+uint16_t const combo_df[] = {KC_D, KC_F, COMBO_END};
+uint16_t const combo_dg[] = {KC_D, KC_G, COMBO_END};
+uint16_t const combo_dh[] = {KC_D, KC_H, COMBO_END};
+uint16_t const combo_di[] = {KC_D, KC_I, COMBO_END};
+uint16_t const combo_dj[] = {KC_D, KC_J, COMBO_END};
+uint16_t const combo_dk[] = {KC_D, KC_K, COMBO_END};
+uint16_t const combo_dl[] = {KC_D, KC_L, COMBO_END};
+uint16_t const combo_dm[] = {KC_D, KC_M, COMBO_END};
+uint16_t const combo_dn[] = {KC_D, KC_N, COMBO_END};
+uint16_t const combo_do[] = {KC_D, KC_O, COMBO_END};
+uint16_t const combo_dp[] = {KC_D, KC_P, COMBO_END};
+uint16_t const combo_dq[] = {KC_D, KC_Q, COMBO_END};
+uint16_t const combo_dr[] = {KC_D, KC_R, COMBO_END};
+uint16_t const combo_ds[] = {KC_D, KC_S, COMBO_END};
+uint16_t const combo_dt[] = {KC_D, KC_T, COMBO_END};
+uint16_t const combo_ef[] = {KC_E, KC_F, COMBO_END};
+uint16_t const combo_eg[] = {KC_E, KC_G, COMBO_END};
+uint16_t const combo_eh[] = {KC_E, KC_H, COMBO_END};
+uint16_t const combo_ei[] = {KC_E, KC_I, COMBO_END};
+uint16_t const combo_ej[] = {KC_E, KC_J, COMBO_END};
+uint16_t const combo_ek[] = {KC_E, KC_K, COMBO_END};
+uint16_t const combo_el[] = {KC_E, KC_L, COMBO_END};
+uint16_t const combo_em[] = {KC_E, KC_M, COMBO_END};
+uint16_t const combo_en[] = {KC_E, KC_N, COMBO_END};
+uint16_t const combo_eo[] = {KC_E, KC_O, COMBO_END};
+uint16_t const combo_ep[] = {KC_E, KC_P, COMBO_END};
+uint16_t const combo_eq[] = {KC_E, KC_Q, COMBO_END};
+uint16_t const combo_er[] = {KC_E, KC_R, COMBO_END};
+uint16_t const combo_es[] = {KC_E, KC_S, COMBO_END};
+uint16_t const combo_et[] = {KC_E, KC_T, COMBO_END};
+uint16_t const combo_fg[] = {KC_F, KC_G, COMBO_END};
+uint16_t const combo_fh[] = {KC_F, KC_H, COMBO_END};
+uint16_t const combo_fi[] = {KC_F, KC_I, COMBO_END};
+uint16_t const combo_fj[] = {KC_F, KC_J, COMBO_END};
+uint16_t const combo_fk[] = {KC_F, KC_K, COMBO_END};
+uint16_t const combo_fl[] = {KC_F, KC_L, COMBO_END};
+uint16_t const combo_fm[] = {KC_F, KC_M, COMBO_END};
+uint16_t const combo_fn[] = {KC_F, KC_N, COMBO_END};
+uint16_t const combo_fo[] = {KC_F, KC_O, COMBO_END};
+uint16_t const combo_fp[] = {KC_F, KC_P, COMBO_END};
+uint16_t const combo_fq[] = {KC_F, KC_Q, COMBO_END};
+uint16_t const combo_fr[] = {KC_F, KC_R, COMBO_END};
+uint16_t const combo_fs[] = {KC_F, KC_S, COMBO_END};
+uint16_t const combo_ft[] = {KC_F, KC_T, COMBO_END};
+uint16_t const combo_gh[] = {KC_G, KC_H, COMBO_END};
+uint16_t const combo_gi[] = {KC_G, KC_I, COMBO_END};
+uint16_t const combo_gj[] = {KC_G, KC_J, COMBO_END};
+uint16_t const combo_gk[] = {KC_G, KC_K, COMBO_END};
+uint16_t const combo_gl[] = {KC_G, KC_L, COMBO_END};
+uint16_t const combo_gm[] = {KC_G, KC_M, COMBO_END};
+uint16_t const combo_gn[] = {KC_G, KC_N, COMBO_END};
+uint16_t const combo_go[] = {KC_G, KC_O, COMBO_END};
+uint16_t const combo_gp[] = {KC_G, KC_P, COMBO_END};
+uint16_t const combo_gq[] = {KC_G, KC_Q, COMBO_END};
+uint16_t const combo_gr[] = {KC_G, KC_R, COMBO_END};
+uint16_t const combo_gs[] = {KC_G, KC_S, COMBO_END};
+uint16_t const combo_gt[] = {KC_G, KC_T, COMBO_END};
+uint16_t const combo_hi[] = {KC_H, KC_I, COMBO_END};
+uint16_t const combo_hj[] = {KC_H, KC_J, COMBO_END};
+uint16_t const combo_hk[] = {KC_H, KC_K, COMBO_END};
+uint16_t const combo_hl[] = {KC_H, KC_L, COMBO_END};
+uint16_t const combo_hm[] = {KC_H, KC_M, COMBO_END};
+uint16_t const combo_hn[] = {KC_H, KC_N, COMBO_END};
+uint16_t const combo_ho[] = {KC_H, KC_O, COMBO_END};
+uint16_t const combo_hp[] = {KC_H, KC_P, COMBO_END};
+uint16_t const combo_hq[] = {KC_H, KC_Q, COMBO_END};
+uint16_t const combo_hr[] = {KC_H, KC_R, COMBO_END};
+uint16_t const combo_hs[] = {KC_H, KC_S, COMBO_END};
+uint16_t const combo_ht[] = {KC_H, KC_T, COMBO_END};
+uint16_t const combo_ij[] = {KC_I, KC_J, COMBO_END};
+uint16_t const combo_ik[] = {KC_I, KC_K, COMBO_END};
+uint16_t const combo_il[] = {KC_I, KC_L, COMBO_END};
+uint16_t const combo_im[] = {KC_I, KC_M, COMBO_END};
+uint16_t const combo_in[] = {KC_I, KC_N, COMBO_END};
+uint16_t const combo_io[] = {KC_I, KC_O, COMBO_END};
+uint16_t const combo_ip[] = {KC_I, KC_P, COMBO_END};
+uint16_t const combo_iq[] = {KC_I, KC_Q, COMBO_END};
+uint16_t const combo_ir[] = {KC_I, KC_R, COMBO_END};
+uint16_t const combo_is[] = {KC_I, KC_S, COMBO_END};
+uint16_t const combo_it[] = {KC_I, KC_T, COMBO_END};
+uint16_t const combo_jk[] = {KC_J, KC_K, COMBO_END};
+uint16_t const combo_jl[] = {KC_J, KC_L, COMBO_END};
+uint16_t const combo_jm[] = {KC_J, KC_M, COMBO_END};
+uint16_t const combo_jn[] = {KC_J, KC_N, COMBO_END};
+uint16_t const combo_jo[] = {KC_J, KC_O, COMBO_END};
+uint16_t const combo_jp[] = {KC_J, KC_P, COMBO_END};
+uint16_t const combo_jq[] = {KC_J, KC_Q, COMBO_END};
+uint16_t const combo_jr[] = {KC_J, KC_R, COMBO_END};
+uint16_t const combo_js[] = {KC_J, KC_S, COMBO_END};
+uint16_t const combo_jt[] = {KC_J, KC_T, COMBO_END};
+uint16_t const combo_kl[] = {KC_K, KC_L, COMBO_END};
+uint16_t const combo_km[] = {KC_K, KC_M, COMBO_END};
+uint16_t const combo_kn[] = {KC_K, KC_N, COMBO_END};
+uint16_t const combo_ko[] = {KC_K, KC_O, COMBO_END};
+uint16_t const combo_kp[] = {KC_K, KC_P, COMBO_END};
+uint16_t const combo_kq[] = {KC_K, KC_Q, COMBO_END};
+uint16_t const combo_kr[] = {KC_K, KC_R, COMBO_END};
+uint16_t const combo_ks[] = {KC_K, KC_S, COMBO_END};
+uint16_t const combo_kt[] = {KC_K, KC_T, COMBO_END};
+uint16_t const combo_lm[] = {KC_L, KC_M, COMBO_END};
+uint16_t const combo_ln[] = {KC_L, KC_N, COMBO_END};
+uint16_t const combo_lo[] = {KC_L, KC_O, COMBO_END};
+uint16_t const combo_lp[] = {KC_L, KC_P, COMBO_END};
+uint16_t const combo_lq[] = {KC_L, KC_Q, COMBO_END};
+uint16_t const combo_lr[] = {KC_L, KC_R, COMBO_END};
+uint16_t const combo_ls[] = {KC_L, KC_S, COMBO_END};
+uint16_t const combo_lt[] = {KC_L, KC_T, COMBO_END};
+uint16_t const combo_mn[] = {KC_M, KC_N, COMBO_END};
+uint16_t const combo_mo[] = {KC_M, KC_O, COMBO_END};
+uint16_t const combo_mp[] = {KC_M, KC_P, COMBO_END};
+uint16_t const combo_mq[] = {KC_M, KC_Q, COMBO_END};
+uint16_t const combo_mr[] = {KC_M, KC_R, COMBO_END};
+uint16_t const combo_ms[] = {KC_M, KC_S, COMBO_END};
+uint16_t const combo_mt[] = {KC_M, KC_T, COMBO_END};
+uint16_t const combo_no[] = {KC_N, KC_O, COMBO_END};
+uint16_t const combo_np[] = {KC_N, KC_P, COMBO_END};
+uint16_t const combo_nq[] = {KC_N, KC_Q, COMBO_END};
+uint16_t const combo_nr[] = {KC_N, KC_R, COMBO_END};
+uint16_t const combo_ns[] = {KC_N, KC_S, COMBO_END};
+uint16_t const combo_nt[] = {KC_N, KC_T, COMBO_END};
+uint16_t const combo_op[] = {KC_O, KC_P, COMBO_END};
+uint16_t const combo_oq[] = {KC_O, KC_Q, COMBO_END};
+uint16_t const combo_or[] = {KC_O, KC_R, COMBO_END};
+uint16_t const combo_os[] = {KC_O, KC_S, COMBO_END};
+uint16_t const combo_ot[] = {KC_O, KC_T, COMBO_END};
+uint16_t const combo_pq[] = {KC_P, KC_Q, COMBO_END};
+uint16_t const combo_pr[] = {KC_P, KC_R, COMBO_END};
+uint16_t const combo_ps[] = {KC_P, KC_S, COMBO_END};
+uint16_t const combo_pt[] = {KC_P, KC_T, COMBO_END};
+uint16_t const combo_qr[] = {KC_Q, KC_R, COMBO_END};
+uint16_t const combo_qs[] = {KC_Q, KC_S, COMBO_END};
+uint16_t const combo_qt[] = {KC_Q, KC_T, COMBO_END};
+uint16_t const combo_rs[] = {KC_R, KC_S, COMBO_END};
+uint16_t const combo_rt[] = {KC_R, KC_T, COMBO_END};
+uint16_t const combo_st[] = {KC_S, KC_T, COMBO_END};
+uint16_t const combo_abc[] = {KC_A, KC_B, KC_C, COMBO_END};
+uint16_t const combo_bcd[] = {KC_B, KC_C, KC_D, COMBO_END};
+uint16_t const combo_cde[] = {KC_C, KC_D, KC_E, COMBO_END};
+uint16_t const combo_def[] = {KC_D, KC_E, KC_F, COMBO_END};
+uint16_t const combo_efg[] = {KC_E, KC_F, KC_G, COMBO_END};
+uint16_t const combo_fgh[] = {KC_F, KC_G, KC_H, COMBO_END};
+uint16_t const combo_ghi[] = {KC_G, KC_H, KC_I, COMBO_END};
+uint16_t const combo_hij[] = {KC_H, KC_I, KC_J, COMBO_END};
+uint16_t const combo_ijk[] = {KC_I, KC_J, KC_K, COMBO_END};
+uint16_t const combo_jkl[] = {KC_J, KC_K, KC_L, COMBO_END};
+uint16_t const combo_klm[] = {KC_K, KC_L, KC_M, COMBO_END};
+uint16_t const combo_lmn[] = {KC_L, KC_M, KC_N, COMBO_END};
+uint16_t const combo_mno[] = {KC_M, KC_N, KC_O, COMBO_END};
+uint16_t const combo_nop[] = {KC_N, KC_O, KC_P, COMBO_END};
+uint16_t const combo_opq[] = {KC_O, KC_P, KC_Q, COMBO_END};
+uint16_t const combo_pqr[] = {KC_P, KC_Q, KC_R, COMBO_END};
+uint16_t const combo_qrs[] = {KC_Q, KC_R, KC_S, COMBO_END};
+uint16_t const combo_rst[] = {KC_R, KC_S, KC_T, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO_ACTION(combo_ab),
+    COMBO_ACTION(combo_ac),
+    COMBO_ACTION(combo_ad),
+    COMBO_ACTION(combo_ae),
+    COMBO_ACTION(combo_af),
+    COMBO_ACTION(combo_ag),
+    COMBO_ACTION(combo_ah),
+    COMBO_ACTION(combo_ai),
+    COMBO_ACTION(combo_aj),
+    COMBO_ACTION(combo_ak),
+    COMBO_ACTION(combo_al),
+    COMBO_ACTION(combo_am),
+    COMBO_ACTION(combo_an),
+    COMBO_ACTION(combo_ao),
+    COMBO_ACTION(combo_ap),
+    COMBO_ACTION(combo_aq),
+    COMBO_ACTION(combo_ar),
+    COMBO_ACTION(combo_as),
+    COMBO_ACTION(combo_at),
+    COMBO_ACTION(combo_bc),
+    COMBO_ACTION(combo_bd),
+    COMBO_ACTION(combo_be),
+    COMBO_ACTION(combo_bf),
+    COMBO_ACTION(combo_bg),
+    COMBO_ACTION(combo_bh),
+    COMBO_ACTION(combo_bi),
+    COMBO_ACTION(combo_bj),
+    COMBO_ACTION(combo_bk),
+    COMBO_ACTION(combo_bl),
+    COMBO_ACTION(combo_bm),
+    COMBO_ACTION(combo_bn),
+    COMBO_ACTION(combo_bo),
+    COMBO_ACTION(combo_bp),
+    COMBO_ACTION(combo_bq),
+    COMBO_ACTION(combo_br),
+    COMBO_ACTION(combo_bs),
+    COMBO_ACTION(combo_bt),
+    COMBO_ACTION(combo_cd),
+    COMBO_ACTION(combo_ce),
+    COMBO_ACTION(combo_cf),
+    COMBO_ACTION(combo_cg),
+    COMBO_ACTION(combo_ch),
+    COMBO_ACTION(combo_ci),
+    COMBO_ACTION(combo_cj),
+    COMBO_ACTION(combo_ck),
+    COMBO_ACTION(combo_cl),
+    COMBO_ACTION(combo_cm),
+    COMBO_ACTION(combo_cn),
+    COMBO_ACTION(combo_co),
+    COMBO_ACTION(combo_cp),
+    COMBO_ACTION(combo_cq),
+    COMBO_ACTION(combo_cr),
+    COMBO_ACTION(combo_cs),
+    COMBO_ACTION(combo_ct),
+    COMBO_ACTION(combo_de),
+    COMBO_ACTION(combo_df),
+    COMBO_ACTION(combo_dg),
+    COMBO_ACTION(combo_dh),
+    COMBO_ACTION(combo_di),
+    COMBO_ACTION(combo_dj),
+    COMBO_ACTION(combo_dk),
+    COMBO_ACTION(combo_dl),
+    COMBO_ACTION(combo_dm),
+    COMBO_ACTION(combo_dn),
+    COMBO_ACTION(combo_do),
+    COMBO_ACTION(combo_dp),
+    COMBO_ACTION(combo_dq),
+    COMBO_ACTION(combo_dr),
+    COMBO_ACTION(combo_ds),
+    COMBO_ACTION(combo_dt),
+    COMBO_ACTION(combo_ef),
+    COMBO_ACTION(combo_eg),
+    COMBO_ACTION(combo_eh),
+    COMBO_ACTION(combo_ei),
+    COMBO_ACTION(combo_ej),
+    COMBO_ACTION(combo_ek),
+    COMBO_ACTION(combo_el),
+    COMBO_ACTION(combo_em),
+    COMBO_ACTION(combo_en),
+    COMBO_ACTION(combo_eo),
+    COMBO_ACTION(combo_ep),
+    COMBO_ACTION(combo_eq),
+    COMBO_ACTION(combo_er),
+    COMBO_ACTION(combo_es),
+    COMBO_ACTION(combo_et),
+    COMBO_ACTION(combo_fg),
+    COMBO_ACTION(combo_fh),
+    COMBO_ACTION(combo_fi),
+    COMBO_ACTION(combo_fj),
+    COMBO_ACTION(combo_fk),
+    COMBO_ACTION(combo_fl),
+    COMBO_ACTION(combo_fm),
+    COMBO_ACTION(combo_fn),
+    COMBO_ACTION(combo_fo),
+    COMBO_ACTION(combo_fp),
+    COMBO_ACTION(combo_fq),
+    COMBO_ACTION(combo_fr),
+    COMBO_ACTION(combo_fs),
+    COMBO_ACTION(combo_ft),
+    COMBO_ACTION(combo_gh),
+    COMBO_ACTION(combo_gi),
+    COMBO_ACTION(combo_gj),
+    COMBO_ACTION(combo_gk),
+    COMBO_ACTION(combo_gl),
+    COMBO_ACTION(combo_gm),
+    COMBO_ACTION(combo_gn),
+    COMBO_ACTION(combo_go),
+    COMBO_ACTION(combo_gp),
+    COMBO_ACTION(combo_gq),
+    COMBO_ACTION(combo_gr),
+    COMBO_ACTION(combo_gs),
+    COMBO_ACTION(combo_gt),
+    COMBO_ACTION(combo_hi),
+    COMBO_ACTION(combo_hj),
+    COMBO_ACTION(combo_hk),
+    COMBO_ACTION(combo_hl),
+    COMBO_ACTION(combo_hm),
+    COMBO_ACTION(combo_hn),
+    COMBO_ACTION(combo_ho),
+    COMBO_ACTION(combo_hp),
+    COMBO_ACTION(combo_hq),
+    COMBO_ACTION(combo_hr),
+    COMBO_ACTION(combo_hs),
+    COMBO_ACTION(combo_ht),
+    COMBO_ACTION(combo_ij),
+    COMBO_ACTION(combo_ik),
+    COMBO_ACTION(combo_il),
+    COMBO_ACTION(combo_im),
+    COMBO_ACTION(combo_in),
+    COMBO_ACTION(combo_io),
+    COMBO_ACTION(combo_ip),
+    COMBO_ACTION(combo_iq),
+    COMBO_ACTION(combo_ir),
+    COMBO_ACTION(combo_is),
+    COMBO_ACTION(combo_it),
+    COMBO_ACTION(combo_jk),
+    COMBO_ACTION(combo_jl),
+    COMBO_ACTION(combo_jm),
+    COMBO_ACTION(combo_jn),
+    COMBO_ACTION(combo_jo),
+    COMBO_ACTION(combo_jp),
+    COMBO_ACTION(combo_jq),
+    COMBO_ACTION(combo_jr),
+    COMBO_ACTION(combo_js),
+    COMBO_ACTION(combo_jt),
+    COMBO_ACTION(combo_kl),
+    COMBO_ACTION(combo_km),
+    COMBO_ACTION(combo_kn),
+    COMBO_ACTION(combo_ko),
+    COMBO_ACTION(combo_kp),
+    COMBO_ACTION(combo_kq),
+    COMBO_ACTION(combo_kr),
+    COMBO_ACTION(combo_ks),
+    COMBO_ACTION(combo_kt),
+    COMBO_ACTION(combo_lm),
+    COMBO_ACTION(combo_ln),
+    COMBO_ACTION(combo_lo),
+    COMBO_ACTION(combo_lp),
+    COMBO_ACTION(combo_lq),
+    COMBO_ACTION(combo_lr),
+    COMBO_ACTION(combo_ls),
+    COMBO_ACTION(combo_lt),
+    COMBO_ACTION(combo_mn),
+    COMBO_ACTION(combo_mo),
+    COMBO_ACTION(combo_mp),
+    COMBO_ACTION(combo_mq),
+    COMBO_ACTION(combo_mr),
+    COMBO_ACTION(combo_ms),
+    COMBO_ACTION(combo_mt),
+    COMBO_ACTION(combo_no),
+    COMBO_ACTION(combo_np),
+    COMBO_ACTION(combo_nq),
+    COMBO_ACTION(combo_nr),
+    COMBO_ACTION(combo_ns),
+    COMBO_ACTION(combo_nt),
+    COMBO_ACTION(combo_op),
+    COMBO_ACTION(combo_oq),
+    COMBO_ACTION(combo_or),
+    COMBO_ACTION(combo_os),
+    COMBO_ACTION(combo_ot),
+    COMBO_ACTION(combo_pq),
+    COMBO_ACTION(combo_pr),
+    COMBO_ACTION(combo_ps),
+    COMBO_ACTION(combo_pt),
+    COMBO_ACTION(combo_qr),
+    COMBO_ACTION(combo_qs),
+    COMBO_ACTION(combo_qt),
+    COMBO_ACTION(combo_rs),
+    COMBO_ACTION(combo_rt),
+    COMBO_ACTION(combo_st),
+    COMBO_ACTION(combo_abc),
+    COMBO_ACTION(combo_bcd),
+    COMBO_ACTION(combo_cde),
+    COMBO_ACTION(combo_def),
+    COMBO_ACTION(combo_efg),
+    COMBO_ACTION(combo_fgh),
+    COMBO_ACTION(combo_ghi),
+    COMBO_ACTION(combo_hij),
+    COMBO_ACTION(combo_ijk),
+    COMBO_ACTION(combo_jkl),
+    COMBO_ACTION(combo_klm),
+    COMBO_ACTION(combo_lmn),
+    COMBO_ACTION(combo_mno),
+    COMBO_ACTION(combo_nop),
+    COMBO_ACTION(combo_opq),
+    COMBO_ACTION(combo_pqr),
+    COMBO_ACTION(combo_qrs),
+    COMBO_ACTION(combo_rst),
+};
+// clang-format on
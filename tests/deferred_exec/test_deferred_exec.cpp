@@ -0,0 +1,236 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <utility>
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+// Invocations as (callback id, time of invocation)
+static std::vector<std::pair<int, uint32_t>> invocations;
+static std::vector<uint32_t>                 trigger_times;
+
+static int      ids[MAX_DEFERRED_EXECUTORS + 1];
+static uint32_t repeat_delay = 0;
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    invocations.push_back({*(int *)cb_arg, timer_read32()});
+    trigger_times.push_back(trigger_time);
+    return repeat_delay;
+}
+
+static deferred_token token_to_cancel = INVALID_DEFERRED_TOKEN;
+
+static uint32_t cancelling_callback(uint32_t trigger_time, void *cb_arg) {
+    record_callback(trigger_time, cb_arg);
+    cancel_deferred_exec(token_to_cancel);
+    return 0;
+}
+
+static deferred_token requeued_token = INVALID_DEFERRED_TOKEN;
+
+static uint32_t requeueing_callback(uint32_t trigger_time, void *cb_arg) {
+    record_callback(trigger_time, cb_arg);
+    cancel_deferred_exec(token_to_cancel);
+    requeued_token = defer_exec(10, record_callback, cb_arg);
+    return 0;
+}
+
+class DeferredExec : public TestFixture {
+   public:
+    void SetUp() override {
+        // The executors outlive each test, keep time moving forward so that their throttling is not confused
+        static uint32_t start_time = 0;
+        start_time += 100000;
+        set_time(start_time);
+
+        invocations.clear();
+        trigger_times.clear();
+        repeat_delay = 0;
+        for (int i = 0; i < MAX_DEFERRED_EXECUTORS + 1; i++) {
+            ids[i] = i;
+        }
+    }
+
+    void TearDown() override {
+        for (deferred_token token : tokens) {
+            cancel_deferred_exec(token);
+        }
+    }
+
+    deferred_token schedule(uint32_t delay_ms, int id, deferred_exec_callback callback = record_callback) {
+        deferred_token token = defer_exec(delay_ms, callback, &ids[id]);
+        tokens.push_back(token);
+        return token;
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_task();
+        }
+    }
+
+    std::vector<deferred_token> tokens;
+};
+
+TEST_F(DeferredExec, CallbacksRunInTriggerOrder) {
+    uint32_t start = timer_read32();
+    schedule(30, 1);
+    schedule(10, 2);
+    schedule(20, 3);
+
+    run_for(40);
+
+    std::vector<std::pair<int, uint32_t>> expected = {{2, start + 10}, {3, start + 20}, {1, start + 30}};
+    EXPECT_EQ(invocations, expected);
+
+    uint32_t deadline;
+    EXPECT_FALSE(deferred_exec_next_deadline(&deadline));
+}
+
+TEST_F(DeferredExec, NextDeadlineIsEarliestTrigger) {
+    uint32_t start = timer_read32();
+    uint32_t deadline;
+
+    EXPECT_FALSE(deferred_exec_next_deadline(&deadline));
+
+    schedule(50, 1);
+    ASSERT_TRUE(deferred_exec_next_deadline(&deadline));
+    EXPECT_EQ(deadline, start + 50);
+
+    deferred_token token = schedule(20, 2);
+    ASSERT_TRUE(deferred_exec_next_deadline(&deadline));
+    EXPECT_EQ(deadline, start + 20);
+
+    EXPECT_TRUE(cancel_deferred_exec(token));
+    ASSERT_TRUE(deferred_exec_next_deadline(&deadline));
+    EXPECT_EQ(deadline, start + 50);
+}
+
+TEST_F(DeferredExec, RepeatingCallbackKeepsItsCadence) {
+    uint32_t start = timer_read32();
+    repeat_delay   = 10;
+    deferred_token token = schedule(10, 1);
+
+    run_for(35);
+    std::vector<uint32_t> expected = {start + 10, start + 20, start + 30};
+    EXPECT_EQ(trigger_times, expected);
+
+    EXPECT_TRUE(cancel_deferred_exec(token));
+    run_for(20);
+    EXPECT_EQ(trigger_times.size(), 3);
+}
+
+TEST_F(DeferredExec, LateRepeatingCallbackRunsOncePerTask) {
+    uint32_t start = timer_read32();
+    repeat_delay   = 1;
+    schedule(1, 1);
+    schedule(3, 2);
+
+    // Both executors are overdue, each runs once and is re-queued into the past
+    advance_time(5);
+    deferred_exec_task();
+    std::vector<std::pair<int, uint32_t>> expected = {{1, start + 5}, {2, start + 5}};
+    EXPECT_EQ(invocations, expected);
+
+    // They catch up on later invocations, relative to their previous trigger time
+    advance_time(1);
+    deferred_exec_task();
+    std::vector<uint32_t> expected_triggers = {start + 1, start + 3, start + 2, start + 4};
+    EXPECT_EQ(trigger_times, expected_triggers);
+}
+
+TEST_F(DeferredExec, ExtendMovesTrigger) {
+    uint32_t       start = timer_read32();
+    deferred_token early = schedule(10, 1);
+    schedule(20, 2);
+
+    run_for(5);
+    EXPECT_TRUE(extend_deferred_exec(early, 30));
+
+    run_for(40);
+    std::vector<std::pair<int, uint32_t>> expected = {{2, start + 20}, {1, start + 35}};
+    EXPECT_EQ(invocations, expected);
+    EXPECT_FALSE(extend_deferred_exec(early, 10));
+}
+
+TEST_F(DeferredExec, CallbackCancelsAnotherDueCallback) {
+    schedule(10, 1, cancelling_callback);
+    token_to_cancel = schedule(10, 2);
+
+    run_for(20);
+    ASSERT_EQ(invocations.size(), 1);
+    EXPECT_EQ(invocations[0].first, 1);
+}
+
+TEST_F(DeferredExec, CallbackCancelsLateRepeatingCallback) {
+    repeat_delay    = 1;
+    token_to_cancel = schedule(1, 1);
+    schedule(3, 2, cancelling_callback);
+
+    advance_time(5);
+    deferred_exec_task();
+    run_for(10);
+    ASSERT_EQ(invocations.size(), 2);
+
+    uint32_t deadline;
+    EXPECT_FALSE(deferred_exec_next_deadline(&deadline));
+}
+
+TEST_F(DeferredExec, FullQueueRejectsExecutors) {
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        EXPECT_NE(schedule(100 + i, i), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(schedule(100, MAX_DEFERRED_EXECUTORS), INVALID_DEFERRED_TOKEN);
+
+    // A freed entry is reused under a new token, the old one stays invalid
+    deferred_token cancelled = tokens[3];
+    EXPECT_TRUE(cancel_deferred_exec(cancelled));
+    deferred_token reused = schedule(5, MAX_DEFERRED_EXECUTORS);
+    EXPECT_NE(reused, INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(reused, cancelled);
+    EXPECT_FALSE(cancel_deferred_exec(cancelled));
+
+    run_for(200);
+    ASSERT_EQ(invocations.size(), MAX_DEFERRED_EXECUTORS);
+    EXPECT_EQ(invocations[0].first, MAX_DEFERRED_EXECUTORS);
+}
+
+TEST_F(DeferredExec, CancelledTokenStaysInvalidWhenEntryIsReused) {
+    deferred_token cancelled = schedule(10, 1);
+    EXPECT_TRUE(cancel_deferred_exec(cancelled));
+
+    // Each executor takes the entry freed by the previous one
+    for (int i = 0; i < 100; i++) {
+        deferred_token token = defer_exec(10, record_callback, &ids[2]);
+        ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+        EXPECT_NE(token, cancelled);
+        EXPECT_FALSE(cancel_deferred_exec(cancelled));
+        EXPECT_TRUE(cancel_deferred_exec(token));
+    }
+}
+
+TEST_F(DeferredExec, CallbackCancelsAndRequeuesItself) {
+    uint32_t start  = timer_read32();
+    token_to_cancel = schedule(10, 1, requeueing_callback);
+
+    run_for(10);
+    ASSERT_NE(requeued_token, INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(requeued_token, token_to_cancel);
+    tokens.push_back(requeued_token);
+
+    // Returning 0 from the cancelled callback must not remove the executor it queued
+    run_for(20);
+    std::vector<std::pair<int, uint32_t>> expected = {{1, start + 10}, {1, start + 20}};
+    EXPECT_EQ(invocations, expected);
+}
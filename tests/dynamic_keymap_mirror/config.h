@@ -0,0 +1,12 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TRANSIENT_EEPROM_SIZE 1024
+#define DYNAMIC_KEYMAP_LAYER_COUNT 2
+#define DYNAMIC_KEYMAP_RAM_MIRROR
+#define DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS 1
+#define DYNAMIC_KEYMAP_FLUSH_DELAY 100
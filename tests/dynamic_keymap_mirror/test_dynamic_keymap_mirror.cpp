@@ -0,0 +1,129 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom.h"
+}
+
+using testing::_;
+
+// Size of one keymap row, and of the mirrored part of the keymap, as laid out in EEPROM
+#define ROW_SIZE (MATRIX_COLS * 2)
+#define MIRROR_SIZE (DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS * MATRIX_ROWS * ROW_SIZE)
+
+class DynamicKeymapMirror : public TestFixture {
+   public:
+    void SetUp() override {
+        dynamic_keymap_reset();
+        dynamic_keymap_flush();
+    }
+
+    uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+        uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        return eeprom_read_byte(address) << 8 | eeprom_read_byte(address + 1);
+    }
+};
+
+TEST_F(DynamicKeymapMirror, ReadsAreServedFromMirror) {
+    dynamic_keymap_set_keycode(0, 1, 2, KC_B);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 2), KC_B);
+    // Not written back yet
+    EXPECT_EQ(eeprom_keycode(0, 1, 2), KC_NO);
+
+    // Layers past DYNAMIC_KEYMAP_RAM_MIRROR_LAYERS go straight to EEPROM
+    dynamic_keymap_set_keycode(1, 1, 2, KC_C);
+    EXPECT_EQ(eeprom_keycode(1, 1, 2), KC_C);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 1, 2), KC_C);
+}
+
+TEST_F(DynamicKeymapMirror, FlushWritesBackDirtyRows) {
+    dynamic_keymap_set_keycode(0, 1, 2, KC_B);
+    dynamic_keymap_set_keycode(0, 3, MATRIX_COLS - 1, LCTL(KC_X));
+
+    // Change EEPROM behind the mirror's back, in a row which is not dirty
+    uint8_t *clean = (uint8_t *)dynamic_keymap_key_to_eeprom_address(0, 2, 0);
+    eeprom_update_byte(clean + 1, KC_Z);
+
+    dynamic_keymap_flush();
+
+    EXPECT_EQ(eeprom_keycode(0, 1, 2), KC_B);
+    EXPECT_EQ(eeprom_keycode(0, 3, MATRIX_COLS - 1), LCTL(KC_X));
+    EXPECT_EQ(eeprom_keycode(0, 2, 0), KC_Z);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 2, 0), KC_NO);
+}
+
+TEST_F(DynamicKeymapMirror, FlushAfterDelay) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_set_keycode(0, 0, 0, KC_A);
+
+    idle_for(DYNAMIC_KEYMAP_FLUSH_DELAY - 1);
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), KC_NO);
+
+    // Further changes push the write back
+    dynamic_keymap_set_keycode(0, 0, 1, KC_B);
+    idle_for(DYNAMIC_KEYMAP_FLUSH_DELAY - 1);
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), KC_NO);
+
+    idle_for(2);
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), KC_A);
+    EXPECT_EQ(eeprom_keycode(0, 0, 1), KC_B);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMirror, BufferAcrossRows) {
+    // Starts on the low byte of the last key of row 0, ends on the high byte of the second key of row 1
+    uint8_t data[4] = {0x04, 0x00, 0x05, 0x00};
+    dynamic_keymap_set_buffer(ROW_SIZE - 1, sizeof(data), data);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, MATRIX_COLS - 1), KC_A);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 0), KC_B);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 1), KC_NO);
+
+    uint8_t read[6] = {0};
+    dynamic_keymap_get_buffer(ROW_SIZE - 2, sizeof(read), read);
+    const uint8_t expected[6] = {0x00, 0x04, 0x00, 0x05, 0x00, 0x00};
+    EXPECT_EQ(memcmp(read, expected, sizeof(read)), 0);
+
+    dynamic_keymap_flush();
+    EXPECT_EQ(eeprom_keycode(0, 0, MATRIX_COLS - 1), KC_A);
+    EXPECT_EQ(eeprom_keycode(0, 1, 0), KC_B);
+}
+
+TEST_F(DynamicKeymapMirror, BufferAcrossMirrorEnd) {
+    // The last key of the mirror, then the first key of the first layer read from EEPROM
+    uint8_t data[4] = {0x00, 0x06, 0x00, 0x07};
+    dynamic_keymap_set_buffer(MIRROR_SIZE - 2, sizeof(data), data);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, MATRIX_ROWS - 1, MATRIX_COLS - 1), KC_C);
+    EXPECT_EQ(eeprom_keycode(0, MATRIX_ROWS - 1, MATRIX_COLS - 1), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 0, 0), KC_D);
+    EXPECT_EQ(eeprom_keycode(1, 0, 0), KC_D);
+
+    uint8_t read[4] = {0};
+    dynamic_keymap_get_buffer(MIRROR_SIZE - 2, sizeof(read), read);
+    EXPECT_EQ(memcmp(read, data, sizeof(read)), 0);
+}
+
+TEST_F(DynamicKeymapMirror, ResetRestoresDefaults) {
+    dynamic_keymap_set_keycode(0, 1, 2, KC_B);
+    dynamic_keymap_flush();
+    dynamic_keymap_set_keycode(0, 3, 4, KC_C);
+
+    dynamic_keymap_reset();
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 2), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 3, 4), KC_NO);
+
+    dynamic_keymap_flush();
+    EXPECT_EQ(eeprom_keycode(0, 1, 2), KC_NO);
+    EXPECT_EQ(eeprom_keycode(0, 3, 4), KC_NO);
+}
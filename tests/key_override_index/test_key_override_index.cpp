@@ -0,0 +1,141 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "process_key_override.h"
+}
+
+using testing::_;
+
+class KeyOverrideIndex : public TestFixture {
+   public:
+    void SetUp() override {
+        for (const KeymapKey &key : keys) {
+            add_key(key);
+        }
+    }
+
+    // Records every keyboard report as (mods, keys)
+    void capture(TestDriver &driver) {
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly([this](report_keyboard_t &report) { reports.push_back(report); });
+    }
+
+    bool sent(uint8_t keycode, uint8_t mods = 0) {
+        return std::any_of(reports.begin(), reports.end(), [=](const report_keyboard_t &report) { return report.mods == mods && std::find(std::begin(report.keys), std::end(report.keys), keycode) != std::end(report.keys); });
+    }
+
+    bool ever_sent(uint8_t keycode) {
+        return std::any_of(reports.begin(), reports.end(), [=](const report_keyboard_t &report) { return std::find(std::begin(report.keys), std::end(report.keys), keycode) != std::end(report.keys); });
+    }
+
+    // clang-format off
+    std::vector<KeymapKey> keys = {
+        KeymapKey(0, 0, 0, KC_A),           KeymapKey(0, 1, 0, KC_Z),          KeymapKey(0, 2, 0, KC_BSPC),     KeymapKey(0, 3, 0, KC_SPACE),
+        KeymapKey(0, 0, 1, KC_LEFT_SHIFT),  KeymapKey(0, 1, 1, KC_LEFT_CTRL),  KeymapKey(0, 2, 1, KC_LEFT_GUI), KeymapKey(0, 3, 1, KC_RIGHT_CTRL),
+        KeymapKey(0, 4, 1, KC_RIGHT_SHIFT),
+    };
+    // clang-format on
+    KeymapKey &a = keys[0], &z = keys[1], &backspace = keys[2], &space = keys[3];
+    KeymapKey &left_shift = keys[4], &left_ctrl = keys[5], &left_gui = keys[6], &right_ctrl = keys[7], &right_shift = keys[8];
+
+    std::vector<report_keyboard_t> reports;
+};
+
+TEST_F(KeyOverrideIndex, FirstMatchingOverrideWins) {
+    TestDriver driver;
+    capture(driver);
+
+    left_shift.press();
+    run_one_scan_loop();
+    tap_key(a);
+    left_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TRUE(sent(KC_B));
+    EXPECT_FALSE(ever_sent(KC_A));
+    EXPECT_FALSE(ever_sent(KC_C));
+}
+
+TEST_F(KeyOverrideIndex, OverrideDeepInTheList) {
+    TestDriver driver;
+    capture(driver);
+
+    left_gui.press();
+    run_one_scan_loop();
+    tap_key(z);
+    left_gui.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // gui_z is the 79th override, F(1 + 77 % 12)
+    EXPECT_TRUE(sent(KC_F6));
+    EXPECT_FALSE(ever_sent(KC_Z));
+}
+
+TEST_F(KeyOverrideIndex, ModifierPressedAfterTrigger) {
+    TestDriver driver;
+    capture(driver);
+
+    // The override is found through the last key pressed down rather than the modifier
+    backspace.press();
+    idle_for(600);
+    EXPECT_TRUE(sent(KC_BACKSPACE));
+
+    // Activation from a modifier long after the trigger is only delayed slightly
+    left_shift.press();
+    idle_for(100);
+    EXPECT_TRUE(sent(KC_DELETE));
+
+    left_shift.release();
+    run_one_scan_loop();
+    backspace.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, OverrideWithoutTriggerKey) {
+    TestDriver driver;
+    capture(driver);
+
+    right_ctrl.press();
+    run_one_scan_loop();
+    // Activation from a modifier is deferred by the key repeat delay, 500ms by default
+    right_shift.press();
+    idle_for(600);
+    EXPECT_TRUE(sent(KC_ESCAPE));
+
+    right_shift.release();
+    run_one_scan_loop();
+    right_ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, KeyWithoutOverride) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    left_ctrl.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_SPACE));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    tap_key(space);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    left_ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,210 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+/*
+ * A large override set, as used for symbol layers: an override for every
+ * letter with each of six modifier combinations that do not include shift,
+ * framed by the overrides the tests exercise.
+ */
+
+// clang-format off
+const key_override_t shift_backspace = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+
+const key_override_t ctrl_a = ko_make_basic(MOD_MASK_CTRL, KC_A, KC_F1);
+const key_override_t ctrl_b = ko_make_basic(MOD_MASK_CTRL, KC_B, KC_F2);
+const key_override_t ctrl_c = ko_make_basic(MOD_MASK_CTRL, KC_C, KC_F3);
+const key_override_t ctrl_d = ko_make_basic(MOD_MASK_CTRL, KC_D, KC_F4);
+const key_override_t ctrl_e = ko_make_basic(MOD_MASK_CTRL, KC_E, KC_F5);
+const key_override_t ctrl_f = ko_make_basic(MOD_MASK_CTRL, KC_F, KC_F6);
+const key_override_t ctrl_g = ko_make_basic(MOD_MASK_CTRL, KC_G, KC_F7);
+const key_override_t ctrl_h = ko_make_basic(MOD_MASK_CTRL, KC_H, KC_F8);
+const key_override_t ctrl_i = ko_make_basic(MOD_MASK_CTRL, KC_I, KC_F9);
+const key_override_t ctrl_j = ko_make_basic(MOD_MASK_CTRL, KC_J, KC_F10);
+const key_override_t ctrl_k = ko_make_basic(MOD_MASK_CTRL, KC_K, KC_F11);
+const key_override_t ctrl_l = ko_make_basic(MOD_MASK_CTRL, KC_L, KC_F12);
+const key_override_t ctrl_m = ko_make_basic(MOD_MASK_CTRL, KC_M, KC_F1);
+const key_override_t ctrl_n = ko_make_basic(MOD_MASK_CTRL, KC_N, KC_F2);
+const key_override_t ctrl_o = ko_make_basic(MOD_MASK_CTRL, KC_O, KC_F3);
+const key_override_t ctrl_p = ko_make_basic(MOD_MASK_CTRL, KC_P, KC_F4);
+const key_override_t ctrl_q = ko_make_basic(MOD_MASK_CTRL, KC_Q, KC_F5);
+const key_override_t ctrl_r = ko_make_basic(MOD_MASK_CTRL, KC_R, KC_F6);
+const key_override_t ctrl_s = ko_make_basic(MOD_MASK_CTRL, KC_S, KC_F7);
+const key_override_t ctrl_t = ko_make_basic(MOD_MASK_CTRL, KC_T, KC_F8);
+const key_override_t ctrl_u = ko_make_basic(MOD_MASK_CTRL, KC_U, KC_F9);
+const key_override_t ctrl_v = ko_make_basic(MOD_MASK_CTRL, KC_V, KC_F10);
+const key_override_t ctrl_w = ko_make_basic(MOD_MASK_CTRL, KC_W, KC_F11);
+const key_override_t ctrl_x = ko_make_basic(MOD_MASK_CTRL, KC_X, KC_F12);
+const key_override_t ctrl_y = ko_make_basic(MOD_MASK_CTRL, KC_Y, KC_F1);
+const key_override_t ctrl_z = ko_make_basic(MOD_MASK_CTRL, KC_Z, KC_F2);
+const key_override_t alt_a = ko_make_basic(MOD_MASK_ALT, KC_A, KC_F3);
+const key_override_t alt_b = ko_make_basic(MOD_MASK_ALT, KC_B, KC_F4);
+const key_override_t alt_c = ko_make_basic(MOD_MASK_ALT, KC_C, KC_F5);
+const key_override_t alt_d = ko_make_basic(MOD_MASK_ALT, KC_D, KC_F6);
+const key_override_t alt_e = ko_make_basic(MOD_MASK_ALT, KC_E, KC_F7);
+const key_override_t alt_f = ko_make_basic(MOD_MASK_ALT, KC_F, KC_F8);
+const key_override_t alt_g = ko_make_basic(MOD_MASK_ALT, KC_G, KC_F9);
+const key_override_t alt_h = ko_make_basic(MOD_MASK_ALT, KC_H, KC_F10);
+const key_override_t alt_i = ko_make_basic(MOD_MASK_ALT, KC_I, KC_F11);
+const key_override_t alt_j = ko_make_basic(MOD_MASK_ALT, KC_J, KC_F12);
+const key_override_t alt_k = ko_make_basic(MOD_MASK_ALT, KC_K, KC_F1);
+const key_override_t alt_l = ko_make_basic(MOD_MASK_ALT, KC_L, KC_F2);
+const key_override_t alt_m = ko_make_basic(MOD_MASK_ALT, KC_M, KC_F3);
+const key_override_t alt_n = ko_make_basic(MOD_MASK_ALT, KC_N, KC_F4);
+const key_override_t alt_o = ko_make_basic(MOD_MASK_ALT, KC_O, KC_F5);
+const key_override_t alt_p = ko_make_basic(MOD_MASK_ALT, KC_P, KC_F6);
+const key_override_t alt_q = ko_make_basic(MOD_MASK_ALT, KC_Q, KC_F7);
+const key_override_t alt_r = ko_make_basic(MOD_MASK_ALT, KC_R, KC_F8);
+const key_override_t alt_s = ko_make_basic(MOD_MASK_ALT, KC_S, KC_F9);
+const key_override_t alt_t = ko_make_basic(MOD_MASK_ALT, KC_T, KC_F10);
+const key_override_t alt_u = ko_make_basic(MOD_MASK_ALT, KC_U, KC_F11);
+const key_override_t alt_v = ko_make_basic(MOD_MASK_ALT, KC_V, KC_F12);
+const key_override_t alt_w = ko_make_basic(MOD_MASK_ALT, KC_W, KC_F1);
+const key_override_t alt_x = ko_make_basic(MOD_MASK_ALT, KC_X, KC_F2);
+const key_override_t alt_y = ko_make_basic(MOD_MASK_ALT, KC_Y, KC_F3);
+const key_override_t alt_z = ko_make_basic(MOD_MASK_ALT, KC_Z, KC_F4);
+const key_override_t gui_a = ko_make_basic(MOD_MASK_GUI, KC_A, KC_F5);
+const key_override_t gui_b = ko_make_basic(MOD_MASK_GUI, KC_B, KC_F6);
+const key_override_t gui_c = ko_make_basic(MOD_MASK_GUI, KC_C, KC_F7);
+const key_override_t gui_d = ko_make_basic(MOD_MASK_GUI, KC_D, KC_F8);
+const key_override_t gui_e = ko_make_basic(MOD_MASK_GUI, KC_E, KC_F9);
+const key_override_t gui_f = ko_make_basic(MOD_MASK_GUI, KC_F, KC_F10);
+const key_override_t gui_g = ko_make_basic(MOD_MASK_GUI, KC_G, KC_F11);
+const key_override_t gui_h = ko_make_basic(MOD_MASK_GUI, KC_H, KC_F12);
+const key_override_t gui_i = ko_make_basic(MOD_MASK_GUI, KC_I, KC_F1);
+const key_override_t gui_j = ko_make_basic(MOD_MASK_GUI, KC_J, KC_F2);
+const key_override_t gui_k = ko_make_basic(MOD_MASK_GUI, KC_K, KC_F3);
+const key_override_t gui_l = ko_make_basic(MOD_MASK_GUI, KC_L, KC_F4);
+const key_override_t gui_m = ko_make_basic(MOD_MASK_GUI, KC_M, KC_F5);
+const key_override_t gui_n = ko_make_basic(MOD_MASK_GUI, KC_N, KC_F6);
+const key_override_t gui_o = ko_make_basic(MOD_MASK_GUI, KC_O, KC_F7);
+const key_override_t gui_p = ko_make_basic(MOD_MASK_GUI, KC_P, KC_F8);
+const key_override_t gui_q = ko_make_basic(MOD_MASK_GUI, KC_Q, KC_F9);
+const key_override_t gui_r = ko_make_basic(MOD_MASK_GUI, KC_R, KC_F10);
+const key_override_t gui_s = ko_make_basic(MOD_MASK_GUI, KC_S, KC_F11);
+const key_override_t gui_t = ko_make_basic(MOD_MASK_GUI, KC_T, KC_F12);
+const key_override_t gui_u = ko_make_basic(MOD_MASK_GUI, KC_U, KC_F1);
+const key_override_t gui_v = ko_make_basic(MOD_MASK_GUI, KC_V, KC_F2);
+const key_override_t gui_w = ko_make_basic(MOD_MASK_GUI, KC_W, KC_F3);
+const key_override_t gui_x = ko_make_basic(MOD_MASK_GUI, KC_X, KC_F4);
+const key_override_t gui_y = ko_make_basic(MOD_MASK_GUI, KC_Y, KC_F5);
+const key_override_t gui_z = ko_make_basic(MOD_MASK_GUI, KC_Z, KC_F6);
+const key_override_t ca_a = ko_make_basic(MOD_MASK_CA, KC_A, KC_F7);
+const key_override_t ca_b = ko_make_basic(MOD_MASK_CA, KC_B, KC_F8);
+const key_override_t ca_c = ko_make_basic(MOD_MASK_CA, KC_C, KC_F9);
+const key_override_t ca_d = ko_make_basic(MOD_MASK_CA, KC_D, KC_F10);
+const key_override_t ca_e = ko_make_basic(MOD_MASK_CA, KC_E, KC_F11);
+const key_override_t ca_f = ko_make_basic(MOD_MASK_CA, KC_F, KC_F12);
+const key_override_t ca_g = ko_make_basic(MOD_MASK_CA, KC_G, KC_F1);
+const key_override_t ca_h = ko_make_basic(MOD_MASK_CA, KC_H, KC_F2);
+const key_override_t ca_i = ko_make_basic(MOD_MASK_CA, KC_I, KC_F3);
+const key_override_t ca_j = ko_make_basic(MOD_MASK_CA, KC_J, KC_F4);
+const key_override_t ca_k = ko_make_basic(MOD_MASK_CA, KC_K, KC_F5);
+const key_override_t ca_l = ko_make_basic(MOD_MASK_CA, KC_L, KC_F6);
+const key_override_t ca_m = ko_make_basic(MOD_MASK_CA, KC_M, KC_F7);
+const key_override_t ca_n = ko_make_basic(MOD_MASK_CA, KC_N, KC_F8);
+const key_override_t ca_o = ko_make_basic(MOD_MASK_CA, KC_O, KC_F9);
+const key_override_t ca_p = ko_make_basic(MOD_MASK_CA, KC_P, KC_F10);
+const key_override_t ca_q = ko_make_basic(MOD_MASK_CA, KC_Q, KC_F11);
+const key_override_t ca_r = ko_make_basic(MOD_MASK_CA, KC_R, KC_F12);
+const key_override_t ca_s = ko_make_basic(MOD_MASK_CA, KC_S, KC_F1);
+const key_override_t ca_t = ko_make_basic(MOD_MASK_CA, KC_T, KC_F2);
+const key_override_t ca_u = ko_make_basic(MOD_MASK_CA, KC_U, KC_F3);
+const key_override_t ca_v = ko_make_basic(MOD_MASK_CA, KC_V, KC_F4);
+const key_override_t ca_w = ko_make_basic(MOD_MASK_CA, KC_W, KC_F5);
+const key_override_t ca_x = ko_make_basic(MOD_MASK_CA, KC_X, KC_F6);
+const key_override_t ca_y = ko_make_basic(MOD_MASK_CA, KC_Y, KC_F7);
+const key_override_t ca_z = ko_make_basic(MOD_MASK_CA, KC_Z, KC_F8);
+const key_override_t cg_a = ko_make_basic(MOD_MASK_CG, KC_A, KC_F9);
+const key_override_t cg_b = ko_make_basic(MOD_MASK_CG, KC_B, KC_F10);
+const key_override_t cg_c = ko_make_basic(MOD_MASK_CG, KC_C, KC_F11);
+const key_override_t cg_d = ko_make_basic(MOD_MASK_CG, KC_D, KC_F12);
+const key_override_t cg_e = ko_make_basic(MOD_MASK_CG, KC_E, KC_F1);
+const key_override_t cg_f = ko_make_basic(MOD_MASK_CG, KC_F, KC_F2);
+const key_override_t cg_g = ko_make_basic(MOD_MASK_CG, KC_G, KC_F3);
+const key_override_t cg_h = ko_make_basic(MOD_MASK_CG, KC_H, KC_F4);
+const key_override_t cg_i = ko_make_basic(MOD_MASK_CG, KC_I, KC_F5);
+const key_override_t cg_j = ko_make_basic(MOD_MASK_CG, KC_J, KC_F6);
+const key_override_t cg_k = ko_make_basic(MOD_MASK_CG, KC_K, KC_F7);
+const key_override_t cg_l = ko_make_basic(MOD_MASK_CG, KC_L, KC_F8);
+const key_override_t cg_m = ko_make_basic(MOD_MASK_CG, KC_M, KC_F9);
+const key_override_t cg_n = ko_make_basic(MOD_MASK_CG, KC_N, KC_F10);
+const key_override_t cg_o = ko_make_basic(MOD_MASK_CG, KC_O, KC_F11);
+const key_override_t cg_p = ko_make_basic(MOD_MASK_CG, KC_P, KC_F12);
+const key_override_t cg_q = ko_make_basic(MOD_MASK_CG, KC_Q, KC_F1);
+const key_override_t cg_r = ko_make_basic(MOD_MASK_CG, KC_R, KC_F2);
+const key_override_t cg_s = ko_make_basic(MOD_MASK_CG, KC_S, KC_F3);
+const key_override_t cg_t = ko_make_basic(MOD_MASK_CG, KC_T, KC_F4);
+const key_override_t cg_u = ko_make_basic(MOD_MASK_CG, KC_U, KC_F5);
+const key_override_t cg_v = ko_make_basic(MOD_MASK_CG, KC_V, KC_F6);
+const key_override_t cg_w = ko_make_basic(MOD_MASK_CG, KC_W, KC_F7);
+const key_override_t cg_x = ko_make_basic(MOD_MASK_CG, KC_X, KC_F8);
+const key_override_t cg_y = ko_make_basic(MOD_MASK_CG, KC_Y, KC_F9);
+const key_override_t cg_z = ko_make_basic(MOD_MASK_CG, KC_Z, KC_F10);
+const key_override_t ag_a = ko_make_basic(MOD_MASK_AG, KC_A, KC_F11);
+const key_override_t ag_b = ko_make_basic(MOD_MASK_AG, KC_B, KC_F12);
+const key_override_t ag_c = ko_make_basic(MOD_MASK_AG, KC_C, KC_F1);
+const key_override_t ag_d = ko_make_basic(MOD_MASK_AG, KC_D, KC_F2);
+const key_override_t ag_e = ko_make_basic(MOD_MASK_AG, KC_E, KC_F3);
+const key_override_t ag_f = ko_make_basic(MOD_MASK_AG, KC_F, KC_F4);
+const key_override_t ag_g = ko_make_basic(MOD_MASK_AG, KC_G, KC_F5);
+const key_override_t ag_h = ko_make_basic(MOD_MASK_AG, KC_H, KC_F6);
+const key_override_t ag_i = ko_make_basic(MOD_MASK_AG, KC_I, KC_F7);
+const key_override_t ag_j = ko_make_basic(MOD_MASK_AG, KC_J, KC_F8);
+const key_override_t ag_k = ko_make_basic(MOD_MASK_AG, KC_K, KC_F9);
+const key_override_t ag_l = ko_make_basic(MOD_MASK_AG, KC_L, KC_F10);
+const key_override_t ag_m = ko_make_basic(MOD_MASK_AG, KC_M, KC_F11);
+const key_override_t ag_n = ko_make_basic(MOD_MASK_AG, KC_N, KC_F12);
+const key_override_t ag_o = ko_make_basic(MOD_MASK_AG, KC_O, KC_F1);
+const key_override_t ag_p = ko_make_basic(MOD_MASK_AG, KC_P, KC_F2);
+const key_override_t ag_q = ko_make_basic(MOD_MASK_AG, KC_Q, KC_F3);
+const key_override_t ag_r = ko_make_basic(MOD_MASK_AG, KC_R, KC_F4);
+const key_override_t ag_s = ko_make_basic(MOD_MASK_AG, KC_S, KC_F5);
+const key_override_t ag_t = ko_make_basic(MOD_MASK_AG, KC_T, KC_F6);
+const key_override_t ag_u = ko_make_basic(MOD_MASK_AG, KC_U, KC_F7);
+const key_override_t ag_v = ko_make_basic(MOD_MASK_AG, KC_V, KC_F8);
+const key_override_t ag_w = ko_make_basic(MOD_MASK_AG, KC_W, KC_F9);
+const key_override_t ag_x = ko_make_basic(MOD_MASK_AG, KC_X, KC_F10);
+const key_override_t ag_y = ko_make_basic(MOD_MASK_AG, KC_Y, KC_F11);
+const key_override_t ag_z = ko_make_basic(MOD_MASK_AG, KC_Z, KC_F12);
+const key_override_t shift_a_first  = ko_make_basic(MOD_MASK_SHIFT, KC_A, KC_B);
+const key_override_t shift_a_second = ko_make_basic(MOD_MASK_SHIFT, KC_A, KC_C);
+const key_override_t right_ctrl_shift = ko_make_basic(MOD_BIT(KC_RIGHT_CTRL) | MOD_BIT(KC_RIGHT_SHIFT), KC_NO, KC_ESC);
+
+const key_override_t *test_key_overrides[] = {
+    &shift_backspace,
+    &ctrl_a, &ctrl_b, &ctrl_c, &ctrl_d, &ctrl_e, &ctrl_f,
+    &ctrl_g, &ctrl_h, &ctrl_i, &ctrl_j, &ctrl_k, &ctrl_l,
+    &ctrl_m, &ctrl_n, &ctrl_o, &ctrl_p, &ctrl_q, &ctrl_r,
+    &ctrl_s, &ctrl_t, &ctrl_u, &ctrl_v, &ctrl_w, &ctrl_x,
+    &ctrl_y, &ctrl_z, &alt_a, &alt_b, &alt_c, &alt_d,
+    &alt_e, &alt_f, &alt_g, &alt_h, &alt_i, &alt_j,
+    &alt_k, &alt_l, &alt_m, &alt_n, &alt_o, &alt_p,
+    &alt_q, &alt_r, &alt_s, &alt_t, &alt_u, &alt_v,
+    &alt_w, &alt_x, &alt_y, &alt_z, &gui_a, &gui_b,
+    &gui_c, &gui_d, &gui_e, &gui_f, &gui_g, &gui_h,
+    &gui_i, &gui_j, &gui_k, &gui_l, &gui_m, &gui_n,
+    &gui_o, &gui_p, &gui_q, &gui_r, &gui_s, &gui_t,
+    &gui_u, &gui_v, &gui_w, &gui_x, &gui_y, &gui_z,
+    &ca_a, &ca_b, &ca_c, &ca_d, &ca_e, &ca_f,
+    &ca_g, &ca_h, &ca_i, &ca_j, &ca_k, &ca_l,
+    &ca_m, &ca_n, &ca_o, &ca_p, &ca_q, &ca_r,
+    &ca_s, &ca_t, &ca_u, &ca_v, &ca_w, &ca_x,
+    &ca_y, &ca_z, &cg_a, &cg_b, &cg_c, &cg_d,
+    &cg_e, &cg_f, &cg_g, &cg_h, &cg_i, &cg_j,
+    &cg_k, &cg_l, &cg_m, &cg_n, &cg_o, &cg_p,
+    &cg_q, &cg_r, &cg_s, &cg_t, &cg_u, &cg_v,
+    &cg_w, &cg_x, &cg_y, &cg_z, &ag_a, &ag_b,
+    &ag_c, &ag_d, &ag_e, &ag_f, &ag_g, &ag_h,
+    &ag_i, &ag_j, &ag_k, &ag_l, &ag_m, &ag_n,
+    &ag_o, &ag_p, &ag_q, &ag_r, &ag_s, &ag_t,
+    &ag_u, &ag_v, &ag_w, &ag_x, &ag_y, &ag_z,
+    &shift_a_first,
+    &shift_a_second,
+    &right_ctrl_shift,
+    NULL
+};
+// clang-format on
+
+const key_override_t **key_overrides = test_key_overrides;
@@ -0,0 +1,104 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using ::testing::_;
+using ::testing::AnyNumber;
+
+namespace {
+
+struct processed_record_t {
+    uint16_t   keycode;
+    keyevent_t event;
+    uint32_t   processed_time_hires;
+};
+
+std::vector<processed_record_t> processed_records;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+    processed_records.push_back({keycode, record->event, timer_read_hires()});
+    return true;
+}
+
+class KeyEventHiresTime : public TestFixture {
+   public:
+    void SetUp() override {
+        processed_records.clear();
+    }
+};
+
+TEST_F(KeyEventHiresTime, EventCarriesScanTime) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    const uint32_t press_scan_time = timer_read_hires();
+    key.press();
+    run_one_scan_loop();
+    idle_for(49);
+    const uint32_t release_scan_time = timer_read_hires();
+    key.release();
+    run_one_scan_loop();
+
+    ASSERT_EQ(processed_records.size(), 2);
+    EXPECT_TRUE(processed_records[0].event.pressed);
+    EXPECT_EQ(processed_records[0].event.time_hires, press_scan_time);
+    EXPECT_FALSE(processed_records[1].event.pressed);
+    EXPECT_EQ(processed_records[1].event.time_hires, release_scan_time);
+    EXPECT_EQ(keyevent_hires_diff_us(processed_records[1].event, processed_records[0].event), 50000);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyEventHiresTime, HeldTapKeyKeepsScanTime) {
+    TestDriver driver;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    const uint32_t press_scan_time = timer_read_hires();
+    mod_tap_key.press();
+    idle_for(TAPPING_TERM + 1);
+
+    // The press is only processed once the tapping term has expired, but still carries the time it was scanned
+    ASSERT_EQ(processed_records.size(), 1);
+    EXPECT_EQ(processed_records[0].event.time_hires, press_scan_time);
+    EXPECT_GE(timer_hires_to_us(TIMER_DIFF_32(processed_records[0].processed_time_hires, processed_records[0].event.time_hires)), TAPPING_TERM * 1000);
+
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyEventHiresTime, TapKeyReleaseAfterSecondTap) {
+    TestDriver driver;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    tap_key(mod_tap_key);
+    const uint32_t second_press_scan_time = timer_read_hires();
+    mod_tap_key.press();
+    run_one_scan_loop();
+    mod_tap_key.release();
+    run_one_scan_loop();
+
+    // Every record, including the release synthesized by the tapping state machine, has a timestamp from a scan
+    for (const auto& record : processed_records) {
+        EXPECT_LE(record.event.time_hires, record.processed_time_hires);
+    }
+    EXPECT_EQ(processed_records.back().event.time_hires, second_press_scan_time + 1000);
+    VERIFY_AND_CLEAR(driver);
+}
+
+} // namespace
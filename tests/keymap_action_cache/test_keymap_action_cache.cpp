@@ -0,0 +1,137 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "keymap_common.h"
+}
+
+using ::testing::_;
+
+extern keymap_config_t keymap_config;
+
+class KeymapActionCache : public TestFixture {
+   public:
+    void TearDown() override {
+        keymap_config.swap_lalt_lgui = false;
+        eeconfig_update_keymap(keymap_config.raw);
+    }
+
+    // Replaces the keymap without invalidating the cache, as keyboards with keymap state of their own would
+    void set_keymap_behind_cache(std::initializer_list<KeymapKey> keys) {
+        keymap.clear();
+        for (const KeymapKey& key : keys) {
+            keymap.push_back(key);
+        }
+    }
+};
+
+TEST_F(KeymapActionCache, ActionIsResolvedFromKeymap) {
+    TestDriver driver;
+    auto       key_a  = KeymapKey(0, 0, 0, KC_A);
+    auto       key_mo = KeymapKey(0, 1, 0, MO(1));
+    auto       key_b  = KeymapKey(1, 0, 0, KC_B);
+
+    set_keymap({key_a, key_mo, key_b});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    key_mo.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    key_mo.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeymapActionCache, CachedActionIsReused) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    // Changing the keymap behind the cache's back keeps the resolved action
+    set_keymap_behind_cache({KeymapKey(0, 0, 0, KC_B)});
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeymapActionCache, KeymapConfigChangeInvalidatesCache) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_LEFT_ALT);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_LEFT_ALT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    // Changed in RAM only, as keymaps toggling GUI swaps do
+    keymap_config.swap_lalt_lgui = true;
+    EXPECT_REPORT(driver, (KC_LEFT_GUI));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    keymap_config.swap_lalt_lgui = false;
+    EXPECT_REPORT(driver, (KC_LEFT_ALT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeymapActionCache, InvalidatingKeyKeepsRestOfRow) {
+    TestDriver driver;
+    auto       key_0 = KeymapKey(0, 0, 0, KC_A);
+    auto       key_1 = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({key_0, key_1});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_0);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_1);
+    VERIFY_AND_CLEAR(driver);
+
+    // Only the invalidated key is resolved again from the new keymap
+    set_keymap_behind_cache({KeymapKey(0, 0, 0, KC_C), KeymapKey(0, 1, 0, KC_D)});
+    keymap_action_cache_invalidate_key(0, 0, 1);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_0);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_1);
+    VERIFY_AND_CLEAR(driver);
+}
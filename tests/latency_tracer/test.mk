@@ -0,0 +1,4 @@
+# Copyright 2023 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+LATENCY_TRACER_ENABLE = yes
@@ -0,0 +1,209 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "latency_tracer.h"
+#include "timing_histogram.h"
+}
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+
+class LatencyTracer : public TestFixture {
+   public:
+    void SetUp() override {
+        latency_tracer_reset();
+    }
+
+    latency_tracer_stats_t stats(latency_tracer_stage_t stage) {
+        latency_tracer_stats_t stats;
+        EXPECT_TRUE(latency_tracer_get_stats(stage, &stats));
+        return stats;
+    }
+};
+
+TEST_F(LatencyTracer, ReportInSameScan) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    auto detect_to_queue = stats(LATENCY_TRACER_DETECT_TO_QUEUE);
+    EXPECT_EQ(detect_to_queue.count, 1);
+    EXPECT_EQ(detect_to_queue.max, 0);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(stats(LATENCY_TRACER_DETECT_TO_QUEUE).count, 2);
+}
+
+TEST_F(LatencyTracer, DelayedReportMeasuredFromScan) {
+    TestDriver driver;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    mod_tap_key.press();
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    // The hold is only reported once the tapping term expires
+    auto detect_to_queue = stats(LATENCY_TRACER_DETECT_TO_QUEUE);
+    EXPECT_EQ(detect_to_queue.count, 1);
+    EXPECT_GE(detect_to_queue.min, TAPPING_TERM * 1000);
+    EXPECT_LE(detect_to_queue.max, (TAPPING_TERM + 1) * 1000);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LatencyTracer, EventWithoutReportIsNotCounted) {
+    TestDriver driver;
+    auto       layer_key = KeymapKey(0, 0, 0, MO(1));
+    auto       key       = KeymapKey(1, 0, 0, KC_A);
+
+    set_keymap({layer_key, key});
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    idle_for(LATENCY_TRACER_TIMEOUT + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(stats(LATENCY_TRACER_DETECT_TO_QUEUE).count, 0);
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LatencyTracer, TransferCompletion) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Simulate the USB driver starting the transfer, then the host polling the endpoint 3ms after the report was queued
+    latency_tracer_transfer_started_i(1);
+    latency_tracer_transfer_completed_i(2);
+    idle_for(2);
+    latency_tracer_transfer_completed_i(1);
+
+    auto queue_to_sent = stats(LATENCY_TRACER_QUEUE_TO_SENT);
+    EXPECT_EQ(queue_to_sent.count, 1);
+    EXPECT_EQ(queue_to_sent.max, 3000);
+    auto detect_to_sent = stats(LATENCY_TRACER_DETECT_TO_SENT);
+    EXPECT_EQ(detect_to_sent.count, 1);
+    EXPECT_EQ(detect_to_sent.max, 3000);
+
+    // Transfers which do not carry a traced report are ignored
+    latency_tracer_transfer_started_i(1);
+    latency_tracer_transfer_completed_i(1);
+    EXPECT_EQ(stats(LATENCY_TRACER_QUEUE_TO_SENT).count, 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LatencyTracer, DroppedTransferIsNotClaimedLater) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The USB driver could not send the report, a later transfer must not be attributed to it
+    latency_tracer_transfer_dropped_i();
+    latency_tracer_transfer_started_i(1);
+    latency_tracer_transfer_completed_i(1);
+    EXPECT_EQ(stats(LATENCY_TRACER_QUEUE_TO_SENT).count, 0);
+    EXPECT_EQ(stats(LATENCY_TRACER_DETECT_TO_SENT).count, 0);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LatencyTracer, SaturatedHistogramKeepsPercentiles) {
+    timing_histogram_t       hist        = {0};
+    uint16_t                 buckets[16] = {0};
+    timing_histogram_stats_t stats;
+
+    // 99.5% of samples at 2, 0.5% at 100, for well over UINT16_MAX samples
+    for (uint32_t i = 0; i < 200000; i++) {
+        timing_histogram_record(&hist, buckets, 16, i % 200 == 199 ? 100 : 2);
+    }
+    timing_histogram_get_stats(&hist, buckets, 16, &stats);
+
+    EXPECT_EQ(stats.count, 200000);
+    EXPECT_EQ(stats.p50, 2);
+    EXPECT_EQ(stats.p99, 2);
+    EXPECT_EQ(stats.max, 100);
+
+    // Shift the distribution, which must still be visible once buckets have been rescaled
+    for (uint32_t i = 0; i < 200000; i++) {
+        timing_histogram_record(&hist, buckets, 16, 100);
+    }
+    timing_histogram_get_stats(&hist, buckets, 16, &stats);
+
+    EXPECT_EQ(stats.count, 400000);
+    EXPECT_EQ(stats.p50, 100);
+    EXPECT_EQ(stats.p99, 100);
+}
+
+TEST_F(LatencyTracer, RawHidReport) {
+    TestDriver driver;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    mod_tap_key.press();
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    auto    expected = stats(LATENCY_TRACER_DETECT_TO_QUEUE);
+    uint8_t data[32] = {0x50, LATENCY_TRACER_DETECT_TO_QUEUE};
+    latency_tracer_raw_hid_report(data, sizeof(data));
+
+    EXPECT_EQ(data[0], 0x50);
+    EXPECT_EQ(data[2], LATENCY_TRACER_STAGE_COUNT);
+    EXPECT_EQ(data[3] | data[4] << 8 | data[5] << 16 | data[6] << 24, 1);
+    EXPECT_EQ(data[7] | data[8] << 8 | data[9] << 16 | data[10] << 24, expected.min);
+    EXPECT_EQ(data[23] | data[24] << 8 | data[25] << 16 | data[26] << 24, expected.p99);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,86 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using ::testing::_;
+
+class LayerOpacityCache : public TestFixture {};
+
+TEST_F(LayerOpacityCache, TransparentKeysFallThrough) {
+    TestDriver driver;
+    auto       key_a   = KeymapKey(0, 0, 0, KC_A);
+    auto       key_a_1 = KeymapKey(1, 0, 0, KC_B);
+    auto       key_a_2 = KeymapKey(2, 0, 0, KC_TRNS);
+    auto       key_b   = KeymapKey(0, 1, 0, KC_C);
+    auto       key_b_1 = KeymapKey(1, 1, 0, KC_TRNS);
+    auto       key_b_2 = KeymapKey(2, 1, 0, KC_TRNS);
+
+    set_keymap({key_a, key_a_1, key_a_2, key_b, key_b_1, key_b_2});
+
+    for (int i = 0; i < 2; i++) {
+        layer_state_set(0b111);
+
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+        tap_key(key_a);
+        VERIFY_AND_CLEAR(driver);
+
+        EXPECT_REPORT(driver, (KC_C));
+        EXPECT_EMPTY_REPORT(driver);
+        tap_key(key_b);
+        VERIFY_AND_CLEAR(driver);
+
+        layer_state_set(0b101);
+
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        tap_key(key_a);
+        VERIFY_AND_CLEAR(driver);
+    }
+}
+
+TEST_F(LayerOpacityCache, InactiveLayersAreNotLookedUp) {
+    TestDriver driver;
+    auto       key_a   = KeymapKey(0, 0, 0, KC_A);
+    auto       key_a_3 = KeymapKey(3, 0, 0, KC_D);
+
+    // Layers 1 and 2 are not mapped, the fixture fails the test if they are looked up
+    set_keymap({key_a, key_a_3});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    layer_on(3);
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerOpacityCache, KeymapChangeInvalidatesKey) {
+    TestDriver driver;
+    auto       key_a   = KeymapKey(0, 0, 0, KC_A);
+    auto       key_a_1 = KeymapKey(1, 0, 0, KC_TRNS);
+
+    set_keymap({key_a, key_a_1});
+    layer_on(1);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    set_keymap({key_a, KeymapKey(1, 0, 0, KC_B)});
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
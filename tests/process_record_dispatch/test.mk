@@ -0,0 +1,8 @@
+# Copyright 2023 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Features whose handlers only act on their own keycode range
+SECURE_ENABLE = yes
+DYNAMIC_TAPPING_TERM_ENABLE = yes
+PROGRAMMABLE_BUTTON_ENABLE = yes
+TRI_LAYER_ENABLE = yes
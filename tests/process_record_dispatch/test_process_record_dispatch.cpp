@@ -0,0 +1,225 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "programmable_button.h"
+#include "secure.h"
+}
+
+using ::testing::_;
+
+extern keymap_config_t keymap_config;
+
+static uint16_t user_seen_keycode = KC_NO;
+static uint16_t user_blocked      = KC_NO;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    user_seen_keycode = keycode;
+    return keycode != user_blocked;
+}
+
+class ProcessRecordDispatch : public TestFixture {
+   public:
+    void SetUp() override {
+        user_seen_keycode = KC_NO;
+        user_blocked      = KC_NO;
+    }
+
+    void TearDown() override {
+        keymap_config.swap_control_capslock = false;
+        keymap_config.swap_escape_capslock  = false;
+        eeconfig_update_keymap(keymap_config.raw);
+        g_tapping_term = TAPPING_TERM;
+        secure_lock();
+        programmable_button_clear();
+    }
+};
+
+TEST_F(ProcessRecordDispatch, SecureRangeEdges) {
+    TestDriver driver;
+    auto       lock    = KeymapKey(0, 0, 0, QK_SECURE_LOCK);
+    auto       request = KeymapKey(0, 1, 0, QK_SECURE_REQUEST);
+
+    set_keymap({lock, request});
+
+    EXPECT_NO_REPORT(driver);
+
+    secure_unlock();
+    tap_key(lock);
+    EXPECT_TRUE(secure_is_locked());
+
+    tap_key(request);
+    EXPECT_TRUE(secure_is_unlocking());
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, DynamicTappingTermRangeEdges) {
+    TestDriver driver;
+    auto       down  = KeymapKey(0, 0, 0, QK_DYNAMIC_TAPPING_TERM_DOWN);
+    auto       after = KeymapKey(0, 1, 0, QK_DYNAMIC_TAPPING_TERM_DOWN + 1);
+
+    set_keymap({down, after});
+
+    EXPECT_NO_REPORT(driver);
+
+    tap_key(down);
+    EXPECT_EQ(g_tapping_term, TAPPING_TERM - DYNAMIC_TAPPING_TERM_INCREMENT);
+
+    // Next keycode, outside of the range
+    tap_key(after);
+    EXPECT_EQ(g_tapping_term, TAPPING_TERM - DYNAMIC_TAPPING_TERM_INCREMENT);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, MagicRangeEdges) {
+    TestDriver driver;
+    auto       first = KeymapKey(0, 0, 0, QK_MAGIC_SWAP_CONTROL_CAPS_LOCK);
+    auto       last  = KeymapKey(0, 1, 0, QK_MAGIC_TOGGLE_ESCAPE_CAPS_LOCK);
+
+    set_keymap({first, last});
+
+    EXPECT_NO_REPORT(driver);
+
+    tap_key(first);
+    EXPECT_TRUE(keymap_config.swap_control_capslock);
+
+    tap_key(last);
+    EXPECT_TRUE(keymap_config.swap_escape_capslock);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, GraveEscapeSingleKeycode) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, ProgrammableButtonRangeEdges) {
+    TestDriver driver;
+    auto       before = KeymapKey(0, 0, 0, QK_PROGRAMMABLE_BUTTON - 1);
+    auto       first  = KeymapKey(0, 1, 0, QK_PROGRAMMABLE_BUTTON_1);
+    auto       last   = KeymapKey(0, 2, 0, QK_PROGRAMMABLE_BUTTON_32);
+    auto       after  = KeymapKey(0, 3, 0, QK_PROGRAMMABLE_BUTTON_MAX + 1);
+
+    set_keymap({before, first, last, after});
+
+    EXPECT_NO_REPORT(driver);
+
+    before.press();
+    run_one_scan_loop();
+    EXPECT_EQ(programmable_button_get_report(), 0);
+    before.release();
+    run_one_scan_loop();
+
+    first.press();
+    last.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(programmable_button_is_on(1));
+    EXPECT_TRUE(programmable_button_is_on(32));
+    first.release();
+    last.release();
+    run_one_scan_loop();
+    EXPECT_EQ(programmable_button_get_report(), 0);
+
+    after.press();
+    run_one_scan_loop();
+    EXPECT_EQ(programmable_button_get_report(), 0);
+    after.release();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, TriLayerRangeEdges) {
+    TestDriver driver;
+    auto       before = KeymapKey(0, 0, 0, QK_TRI_LAYER_LOWER - 1);
+    auto       lower  = KeymapKey(0, 1, 0, QK_TRI_LAYER_LOWER);
+    auto       upper  = KeymapKey(0, 2, 0, QK_TRI_LAYER_UPPER);
+    auto       after  = KeymapKey(0, 3, 0, QK_TRI_LAYER_UPPER + 1);
+
+    set_keymap({before, lower, upper, after, KeymapKey(1, 1, 0, KC_TRNS), KeymapKey(1, 2, 0, KC_TRNS), KeymapKey(2, 1, 0, KC_TRNS), KeymapKey(2, 2, 0, KC_TRNS), KeymapKey(3, 1, 0, KC_TRNS), KeymapKey(3, 2, 0, KC_TRNS)});
+
+    EXPECT_NO_REPORT(driver);
+
+    before.press();
+    after.press();
+    run_one_scan_loop();
+    EXPECT_EQ(layer_state, 0);
+    before.release();
+    after.release();
+    run_one_scan_loop();
+
+    lower.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(get_tri_layer_lower_layer()));
+    upper.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_cmp(layer_state, get_tri_layer_adjust_layer()));
+    lower.release();
+    upper.release();
+    run_one_scan_loop();
+    EXPECT_EQ(layer_state, 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, UserHookRunsBeforeRangeHandlers) {
+    TestDriver driver;
+    auto       lower = KeymapKey(0, 0, 0, QK_TRI_LAYER_LOWER);
+
+    set_keymap({lower, KeymapKey(1, 0, 0, KC_TRNS)});
+
+    EXPECT_NO_REPORT(driver);
+
+    // Returning false from process_record_user() stops the chain before the feature handler
+    user_blocked = QK_TRI_LAYER_LOWER;
+    lower.press();
+    run_one_scan_loop();
+    EXPECT_EQ(user_seen_keycode, QK_TRI_LAYER_LOWER);
+    EXPECT_EQ(layer_state, 0);
+    lower.release();
+    run_one_scan_loop();
+
+    user_blocked = KC_NO;
+    lower.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(get_tri_layer_lower_layer()));
+    lower.release();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, UnhandledKeycodeFallsThroughToAction) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    EXPECT_EQ(user_seen_keycode, KC_A);
+    VERIFY_AND_CLEAR(driver);
+
+    // Blocked by the user hook, which runs before any feature handler
+    user_blocked = KC_A;
+    EXPECT_NO_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,61 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+class CoalesceWindow : public TestFixture {};
+
+TEST_F(CoalesceWindow, KeysPressedWithinWindowAreSentTogether) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    // The window opens with the first change and lasts for three scans of 1 ms
+    EXPECT_NO_REPORT(driver);
+    key_a.press();
+    run_one_scan_loop();
+    key_b.press();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(CoalesceWindow, ReleaseWithinWindowFlushesPress) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_NO_REPORT(driver);
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The press has to reach the host before the release, which then waits for a new window
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(3);
+    VERIFY_AND_CLEAR(driver);
+}
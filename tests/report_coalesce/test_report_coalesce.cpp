@@ -0,0 +1,192 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using ::testing::_;
+using ::testing::Field;
+using ::testing::InSequence;
+
+extern "C" void shutdown_quantum(bool jump_to_bootloader);
+
+enum {
+    DOUBLE_TAP_A = SAFE_RANGE,
+    SHIFT_CLICK,
+    HOLD_A,
+};
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+    if (keycode == DOUBLE_TAP_A && record->event.pressed) {
+        tap_code(KC_A);
+        tap_code(KC_A);
+        return false;
+    }
+    if (keycode == SHIFT_CLICK && record->event.pressed) {
+        register_code(KC_LEFT_SHIFT);
+        tap_code(KC_MS_BTN1);
+        unregister_code(KC_LEFT_SHIFT);
+        return false;
+    }
+    if (keycode == HOLD_A && record->event.pressed) {
+        tap_code16_delay(KC_A, 50);
+        return false;
+    }
+    return true;
+}
+
+class ReportCoalesce : public TestFixture {};
+
+TEST_F(ReportCoalesce, KeysPressedInOneScanAreSentTogether) {
+    TestDriver driver;
+    auto       key_b = KeymapKey(0, 0, 0, KC_B);
+    auto       key_c = KeymapKey(0, 1, 1, KC_C);
+
+    set_keymap({key_b, key_c});
+
+    key_b.press();
+    key_c.press();
+    EXPECT_REPORT(driver, (KC_B, KC_C));
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+
+    key_b.release();
+    key_c.release();
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalesce, ReleaseAndPressInOneScanAreSentTogether) {
+    TestDriver driver;
+    auto       key_b = KeymapKey(0, 0, 0, KC_B);
+    auto       key_c = KeymapKey(0, 1, 0, KC_C);
+
+    set_keymap({key_b, key_c});
+
+    EXPECT_REPORT(driver, (KC_B));
+    key_b.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_b.release();
+    key_c.press();
+    EXPECT_REPORT(driver, (KC_C));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalesce, ModifierPressedBeforeKeyIsSentTogether) {
+    TestDriver driver;
+    auto       key_shift = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto       key_a     = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_shift, key_a});
+
+    key_shift.press();
+    key_a.press();
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalesce, ModifierPressedAfterKeyIsSentSeparately) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a     = KeymapKey(0, 0, 0, KC_A);
+    auto       key_shift = KeymapKey(0, 1, 0, KC_LEFT_SHIFT);
+
+    set_keymap({key_a, key_shift});
+
+    key_a.press();
+    key_shift.press();
+    // Merging these would shift a key which was pressed before the modifier
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_LEFT_SHIFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalesce, TapsWithinOneScanAreNotLost) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, DOUBLE_TAP_A);
+
+    set_keymap({key});
+
+    key.press();
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key.release();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalesce, ShutdownFlushesPendingRelease) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The main loop does not run after shutdown, so the release must not be left pending
+    EXPECT_EMPTY_REPORT(driver);
+    shutdown_quantum(false);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalesce, KeyboardReportIsSentBeforeMouseReport) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, SHIFT_CLICK);
+
+    set_keymap({key});
+
+    key.press();
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::buttons, MOUSE_BTN1)));
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::buttons, 0)));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key.release();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalesce, PressIsSentBeforeTapDelay) {
+    TestDriver driver;
+    InSequence s;
+    auto       key      = KeymapKey(0, 0, 0, HOLD_A);
+    uint32_t   pressed  = 0;
+    uint32_t   released = 0;
+
+    set_keymap({key});
+
+    key.press();
+    EXPECT_REPORT(driver, (KC_A)).WillOnce([&](report_keyboard_t&) { pressed = timer_read32(); });
+    EXPECT_EMPTY_REPORT(driver).WillOnce([&](report_keyboard_t&) { released = timer_read32(); });
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_GE(released - pressed, 50);
+
+    key.release();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,114 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+
+extern const led_point_t k_rgb_matrix_center;
+
+RGB  rgb_matrix_hsv_to_rgb(HSV hsv);
+bool CYCLE_PINWHEEL(effect_params_t *params);
+bool CYCLE_SPIRAL(effect_params_t *params);
+}
+
+led_config_t g_led_config = {};
+
+static RGB rendered[RGB_MATRIX_LED_COUNT];
+
+static void test_init(void) {}
+static void test_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    rendered[index].r = r;
+    rendered[index].g = g;
+    rendered[index].b = b;
+}
+static void test_set_color_all(uint8_t r, uint8_t g, uint8_t b) {}
+static void test_flush(void) {}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {test_init, test_set_color, test_set_color_all, test_flush};
+
+// Renders a whole frame of an effect, over as many iterations as RGB_MATRIX_LED_PROCESS_LIMIT requires
+template <typename F>
+static void render_frame(F &&effect) {
+    effect_params_t params = {0, LED_FLAG_ALL, false};
+    while (effect(&params)) {
+        params.iter++;
+    }
+}
+
+class RgbMatrixGeometry : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Spread the LEDs over the whole coordinate space, including its corners
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            g_led_config.point[i] = {(uint8_t)((i % 10) * 224 / 9), (uint8_t)((i / 10) * 64 / 3)};
+            g_led_config.flags[i] = LED_FLAG_KEYLIGHT;
+        }
+        g_led_config.point[RGB_MATRIX_LED_COUNT - 1] = {255, 255};
+        rgb_matrix_update_geometry();
+
+        rgb_matrix_config.hsv   = {0, 255, 255};
+        rgb_matrix_config.speed = 128;
+        g_rgb_timer             = 12345;
+        memset(rendered, 0, sizeof(rendered));
+    }
+
+    static int16_t dx(uint8_t i) {
+        return g_led_config.point[i].x - k_rgb_matrix_center.x;
+    }
+
+    static int16_t dy(uint8_t i) {
+        return g_led_config.point[i].y - k_rgb_matrix_center.y;
+    }
+
+    static uint8_t time() {
+        return scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+    }
+};
+
+TEST_F(RgbMatrixGeometry, TableMatchesPoints) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(g_rgb_led_geometry[i].dx, dx(i)) << "led " << (int)i;
+        EXPECT_EQ(g_rgb_led_geometry[i].dy, dy(i)) << "led " << (int)i;
+        EXPECT_EQ(g_rgb_led_geometry[i].dist, sqrt16(dx(i) * dx(i) + dy(i) * dy(i))) << "led " << (int)i;
+        EXPECT_EQ(g_rgb_led_geometry[i].angle, atan2_8(dy(i), dx(i))) << "led " << (int)i;
+    }
+}
+
+TEST_F(RgbMatrixGeometry, UpdateFollowsMovedLed) {
+    g_led_config.point[3] = led_point_t{k_rgb_matrix_center.x, (uint8_t)(k_rgb_matrix_center.y + 20)};
+    rgb_matrix_update_geometry();
+
+    EXPECT_EQ(g_rgb_led_geometry[3].dx, 0);
+    EXPECT_EQ(g_rgb_led_geometry[3].dy, 20);
+    EXPECT_EQ(g_rgb_led_geometry[3].dist, 20);
+    EXPECT_EQ(g_rgb_led_geometry[3].angle, atan2_8(20, 0));
+}
+
+TEST_F(RgbMatrixGeometry, PinwheelMatchesPerFrameMath) {
+    render_frame(CYCLE_PINWHEEL);
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        HSV hsv = rgb_matrix_config.hsv;
+        hsv.h   = atan2_8(dy(i), dx(i)) + time();
+        RGB rgb = rgb_matrix_hsv_to_rgb(hsv);
+        EXPECT_EQ(rendered[i].r, rgb.r) << "led " << (int)i;
+        EXPECT_EQ(rendered[i].g, rgb.g) << "led " << (int)i;
+        EXPECT_EQ(rendered[i].b, rgb.b) << "led " << (int)i;
+    }
+}
+
+TEST_F(RgbMatrixGeometry, SpiralMatchesPerFrameMath) {
+    render_frame(CYCLE_SPIRAL);
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        HSV hsv = rgb_matrix_config.hsv;
+        hsv.h   = sqrt16(dx(i) * dx(i) + dy(i) * dy(i)) - time() - atan2_8(dy(i), dx(i));
+        RGB rgb = rgb_matrix_hsv_to_rgb(hsv);
+        EXPECT_EQ(rendered[i].r, rgb.r) << "led " << (int)i;
+        EXPECT_EQ(rendered[i].g, rgb.g) << "led " << (int)i;
+        EXPECT_EQ(rendered[i].b, rgb.b) << "led " << (int)i;
+    }
+}
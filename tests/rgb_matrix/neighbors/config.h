@@ -0,0 +1,16 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// One LED per key, plus four underglow LEDs
+#define RGB_MATRIX_LED_COUNT 44
+#define RGB_MATRIX_KEYPRESSES
+#define RGB_MATRIX_FRAMEBUFFER_EFFECTS
+#define RGB_MATRIX_NEIGHBOR_TABLE
+// Too small for every LED, so that the fallback for the last ones is covered too
+#define RGB_MATRIX_NEIGHBOR_TABLE_SIZE 200
+#define ENABLE_RGB_MATRIX_TYPING_HEATMAP
+#define ENABLE_RGB_MATRIX_MULTISPLASH
@@ -0,0 +1,196 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+
+RGB  rgb_matrix_hsv_to_rgb(HSV hsv);
+void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col);
+bool MULTISPLASH(effect_params_t *params);
+}
+
+#define KEY_LED_COUNT (MATRIX_ROWS * MATRIX_COLS)
+
+led_config_t g_led_config = {};
+
+static RGB rendered[RGB_MATRIX_LED_COUNT];
+
+static void test_init(void) {}
+static void test_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    rendered[index].r = r;
+    rendered[index].g = g;
+    rendered[index].b = b;
+}
+static void test_set_color_all(uint8_t r, uint8_t g, uint8_t b) {}
+static void test_flush(void) {}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {test_init, test_set_color, test_set_color_all, test_flush};
+
+static uint8_t led_distance(uint8_t a, uint8_t b) {
+    int16_t dx = g_led_config.point[a].x - g_led_config.point[b].x;
+    int16_t dy = g_led_config.point[a].y - g_led_config.point[b].y;
+    return sqrt16(dx * dx + dy * dy);
+}
+
+class RgbMatrixNeighbors : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        for (uint8_t i = 0; i < KEY_LED_COUNT; i++) {
+            uint8_t row = i / MATRIX_COLS;
+            uint8_t col = i % MATRIX_COLS;
+
+            g_led_config.matrix_co[row][col] = i;
+            g_led_config.point[i]            = {(uint8_t)(col * 224 / (MATRIX_COLS - 1)), (uint8_t)(row * 64 / (MATRIX_ROWS - 1))};
+            g_led_config.flags[i]            = LED_FLAG_KEYLIGHT;
+        }
+        for (uint8_t i = KEY_LED_COUNT; i < RGB_MATRIX_LED_COUNT; i++) {
+            g_led_config.point[i] = {(uint8_t)((i - KEY_LED_COUNT) * 64 + 16), 32};
+            g_led_config.flags[i] = LED_FLAG_UNDERGLOW;
+        }
+        rgb_matrix_update_geometry();
+
+        rgb_matrix_config.hsv   = {0, 255, 255};
+        rgb_matrix_config.speed = 128;
+        memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+        memset(rendered, 0, sizeof(rendered));
+    }
+};
+
+TEST_F(RgbMatrixNeighbors, ListsHoldEveryLedWithinRadius) {
+    uint8_t overflowed = 0;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        const led_neighbor_t *neighbors;
+        uint8_t               count;
+        if (!rgb_matrix_get_neighbors(i, &neighbors, &count)) {
+            overflowed++;
+            continue;
+        }
+
+        uint8_t expected = 0;
+        for (uint8_t j = 0; j < RGB_MATRIX_LED_COUNT; j++) {
+            if (j != i && led_distance(i, j) <= RGB_MATRIX_NEIGHBOR_RADIUS) {
+                ASSERT_LT(expected, count) << "led " << (int)i;
+                EXPECT_EQ(neighbors[expected].index, j) << "led " << (int)i;
+                EXPECT_EQ(neighbors[expected].dist, led_distance(i, j)) << "led " << (int)i;
+                expected++;
+            }
+        }
+        EXPECT_EQ(count, expected) << "led " << (int)i;
+    }
+
+    // The table is deliberately too small to hold the last LEDs
+    EXPECT_GT(overflowed, 0);
+    EXPECT_LT(overflowed, RGB_MATRIX_LED_COUNT);
+}
+
+TEST_F(RgbMatrixNeighbors, DistanceLookup) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        const led_neighbor_t *neighbors;
+        uint8_t               count;
+        bool                  listed = rgb_matrix_get_neighbors(i, &neighbors, &count);
+
+        for (uint8_t j = 0; j < RGB_MATRIX_LED_COUNT; j++) {
+            uint8_t dist = 0xAA;
+            bool    near = i == j || (listed && led_distance(i, j) <= RGB_MATRIX_NEIGHBOR_RADIUS);
+            EXPECT_EQ(rgb_matrix_get_neighbor_distance(i, j, &dist), near) << "leds " << (int)i << ", " << (int)j;
+            if (near) {
+                EXPECT_EQ(dist, led_distance(i, j)) << "leds " << (int)i << ", " << (int)j;
+            }
+        }
+    }
+}
+
+TEST_F(RgbMatrixNeighbors, LedToKey) {
+    uint8_t row, col;
+    EXPECT_TRUE(rgb_matrix_map_led_to_row_column(23, &row, &col));
+    EXPECT_EQ(row, 2);
+    EXPECT_EQ(col, 3);
+    EXPECT_FALSE(rgb_matrix_map_led_to_row_column(KEY_LED_COUNT, &row, &col));
+}
+
+// process_rgb_matrix_typing_heatmap() as it was before the neighbor table, sweeping every key
+static void heatmap_sweep(uint8_t row, uint8_t col) {
+    if (g_led_config.matrix_co[row][col] == NO_LED) {
+        return;
+    }
+    for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
+        for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
+            if (g_led_config.matrix_co[i_row][i_col] == NO_LED) {
+                continue;
+            }
+            if (i_row == row && i_col == col) {
+                g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], 32);
+            } else {
+                uint8_t distance = led_distance(g_led_config.matrix_co[row][col], g_led_config.matrix_co[i_row][i_col]);
+                if (distance <= 40) {
+                    uint8_t amount = qsub8(40, distance);
+                    if (amount > 16) {
+                        amount = 16;
+                    }
+                    g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(RgbMatrixNeighbors, HeatmapMatchesSweep) {
+    uint8_t expected[MATRIX_ROWS][MATRIX_COLS];
+
+    // Every key, whether its LED is in the table or not
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            heatmap_sweep(row, col);
+        }
+    }
+    memcpy(expected, g_rgb_frame_buffer, sizeof(expected));
+    memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            process_rgb_matrix_typing_heatmap(row, col);
+        }
+    }
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            EXPECT_EQ(g_rgb_frame_buffer[row][col], expected[row][col]) << "key " << (int)row << ", " << (int)col;
+        }
+    }
+}
+
+TEST_F(RgbMatrixNeighbors, SplashMatchesPerFrameMath) {
+    const uint8_t hits[] = {0, 14, 27, 39, 5};
+    for (uint8_t j = 0; j < sizeof(hits); j++) {
+        g_last_hit_tracker.x[j]     = g_led_config.point[hits[j]].x;
+        g_last_hit_tracker.y[j]     = g_led_config.point[hits[j]].y;
+        g_last_hit_tracker.index[j] = hits[j];
+        g_last_hit_tracker.tick[j]  = 40 * j;
+    }
+    g_last_hit_tracker.count = sizeof(hits);
+
+    effect_params_t params = {0, LED_FLAG_ALL, false};
+    while (MULTISPLASH(&params)) {
+        params.iter++;
+    }
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        HSV hsv = rgb_matrix_config.hsv;
+        hsv.v   = 0;
+        for (uint8_t j = 0; j < sizeof(hits); j++) {
+            uint16_t tick   = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
+            uint16_t effect = tick - led_distance(i, hits[j]);
+            if (effect > 255) effect = 255;
+            hsv.h += effect;
+            hsv.v = qadd8(hsv.v, 255 - effect);
+        }
+        hsv.v   = scale8(hsv.v, rgb_matrix_config.hsv.v);
+        RGB rgb = rgb_matrix_hsv_to_rgb(hsv);
+        EXPECT_EQ(rendered[i].r, rgb.r) << "led " << (int)i;
+        EXPECT_EQ(rendered[i].g, rgb.g) << "led " << (int)i;
+        EXPECT_EQ(rendered[i].b, rgb.b) << "led " << (int)i;
+    }
+}
@@ -0,0 +1,111 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "scan_profiler.h"
+}
+
+using testing::_;
+
+// Host tools rely on these, whatever features are enabled
+static_assert(SCAN_PROFILER_KEYBOARD_TASK == 0, "slot IDs must not change");
+static_assert(SCAN_PROFILER_COMBO_TASK == 9, "slot IDs must not change");
+static_assert(SCAN_PROFILER_USER == 19, "slot IDs must not change");
+static_assert(SCAN_PROFILER_SLOT_COUNT == 20, "slot IDs must not change");
+
+class ScanProfiler : public TestFixture {
+   public:
+    void SetUp() override {
+        scan_profiler_reset();
+    }
+
+    scan_profiler_stats_t stats(scan_profiler_slot_t slot) {
+        scan_profiler_stats_t stats;
+        EXPECT_TRUE(scan_profiler_get_stats(slot, &stats));
+        return stats;
+    }
+
+    void record(uint32_t ticks, int times) {
+        for (int i = 0; i < times; i++) {
+            scan_profiler_record(SCAN_PROFILER_USER, ticks);
+        }
+    }
+};
+
+TEST_F(ScanProfiler, SmallValuesAreExact) {
+    record(0, 50);
+    record(1, 50);
+
+    auto result = stats(SCAN_PROFILER_USER);
+    EXPECT_EQ(result.count, 100);
+    EXPECT_EQ(result.min, 0);
+    EXPECT_EQ(result.max, 1);
+    EXPECT_EQ(result.p50, 0);
+    EXPECT_EQ(result.p99, 1);
+}
+
+TEST_F(ScanProfiler, PercentilesAreBucketUpperBounds) {
+    // 8 lands in the 8-11 bucket, 20 in the 16-23 one
+    record(8, 98);
+    record(20, 1);
+    record(40, 1);
+
+    auto result = stats(SCAN_PROFILER_USER);
+    EXPECT_EQ(result.p50, 11);
+    EXPECT_EQ(result.p99, 23);
+    EXPECT_EQ(result.mean, (8 * 98 + 20 + 40) / 100);
+}
+
+TEST_F(ScanProfiler, BucketEdges) {
+    // 12 opens the 12-15 bucket, and its bound is clamped to the largest value seen
+    record(11, 1);
+    record(12, 1);
+
+    auto result = stats(SCAN_PROFILER_USER);
+    EXPECT_EQ(result.p50, 11);
+    EXPECT_EQ(result.p99, 12);
+}
+
+TEST_F(ScanProfiler, LastBucketIsOpenEnded) {
+    // With 12 buckets the last one starts at 48, larger values are accumulated in it
+    record(5, 10);
+    record(100000, 90);
+
+    auto result = stats(SCAN_PROFILER_USER);
+    EXPECT_EQ(result.p50, 100000);
+    EXPECT_EQ(result.p99, 100000);
+    EXPECT_EQ(result.max, 100000);
+}
+
+TEST_F(ScanProfiler, ResetClearsStatistics) {
+    record(10, 5);
+    scan_profiler_reset();
+
+    EXPECT_EQ(stats(SCAN_PROFILER_USER).count, 0);
+}
+
+TEST_F(ScanProfiler, DisabledFeatureSlotsHaveNoStorage) {
+    scan_profiler_stats_t result;
+
+    scan_profiler_record(SCAN_PROFILER_COMBO_TASK, 10);
+    EXPECT_FALSE(scan_profiler_get_stats(SCAN_PROFILER_COMBO_TASK, &result));
+    EXPECT_FALSE(scan_profiler_get_stats(SCAN_PROFILER_SLOT_COUNT, &result));
+    EXPECT_STREQ(scan_profiler_slot_name(SCAN_PROFILER_COMBO_TASK), "combo_task");
+}
+
+TEST_F(ScanProfiler, MainLoopIsProfiled) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(stats(SCAN_PROFILER_KEYBOARD_TASK).count, 0);
+    EXPECT_GT(stats(SCAN_PROFILER_MATRIX_SCAN).count, 0);
+}
@@ -0,0 +1,104 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "send_string.h"
+}
+
+using ::testing::_;
+using ::testing::InSequence;
+
+class SendStringBatch : public TestFixture {};
+
+TEST_F(SendStringBatch, DistinctKeysAreReleasedTogether) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("abc");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBatch, RepeatedKeyStartsNewBatch) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_H));
+    EXPECT_REPORT(driver, (KC_H, KC_E));
+    EXPECT_REPORT(driver, (KC_H, KC_E, KC_L));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_L));
+    EXPECT_REPORT(driver, (KC_L, KC_O));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("hello");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBatch, ModifierChangeStartsNewBatch) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_H));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_H, KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("HEy!");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBatch, BatchIsLimitedToReportSize) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D, KC_E));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D, KC_E, KC_F));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_G));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("abcdefg");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBatch, KeycodeSequencesEndBatch) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_LEFT));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("ab" SS_TAP(X_LEFT) "c");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBatch, CharactersWithDelayAreNotBatched) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_with_delay("ab", 1);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,9 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Room for a long roll while a mod-tap key is undecided
+#define WAITING_BUFFER_SIZE 32
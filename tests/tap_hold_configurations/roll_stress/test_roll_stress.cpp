@@ -0,0 +1,145 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+/*
+ * Types rolls faster than the keys are released, over home row mod-tap keys,
+ * and checks that every key is typed once, in order and without modifiers.
+ */
+class RollStress : public TestFixture {
+   public:
+    void SetUp() override {
+        for (const KeymapKey &key : keys) {
+            add_key(key);
+        }
+    }
+
+    // Records the keys added by every report, and whether any report held modifiers
+    void capture(TestDriver &driver) {
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly([this](report_keyboard_t &report) {
+            for (uint8_t key : report.keys) {
+                if (key != KC_NO && std::find(std::begin(held), std::end(held), key) == std::end(held)) {
+                    typed.push_back(key);
+                }
+            }
+            std::copy(std::begin(report.keys), std::end(report.keys), std::begin(held));
+            saw_mods |= report.mods != 0;
+        });
+    }
+
+    /*
+     * Presses key `sequence[i]` at i * interval milliseconds, and releases it
+     * `hold` milliseconds later.
+     */
+    void roll(const std::vector<size_t> &sequence, unsigned interval, unsigned hold) {
+        unsigned end = (sequence.size() - 1) * interval + hold;
+        for (unsigned time = 0; time <= end; time++) {
+            for (size_t i = 0; i < sequence.size(); i++) {
+                if (time == i * interval) {
+                    keys[sequence[i]].press();
+                }
+                if (time == i * interval + hold) {
+                    keys[sequence[i]].release();
+                }
+            }
+            run_one_scan_loop();
+        }
+        idle_for(TAPPING_TERM + 1);
+    }
+
+    std::vector<uint16_t> tap_keycodes(const std::vector<size_t> &sequence) {
+        std::vector<uint16_t> keycodes;
+        for (size_t index : sequence) {
+            keycodes.push_back(QK_MOD_TAP_GET_TAP_KEYCODE(keys[index].code));
+        }
+        return keycodes;
+    }
+
+    // clang-format off
+    std::vector<KeymapKey> keys = {
+        KeymapKey(0, 0, 0, LGUI_T(KC_A)), KeymapKey(0, 1, 0, LALT_T(KC_S)), KeymapKey(0, 2, 0, LCTL_T(KC_D)), KeymapKey(0, 3, 0, LSFT_T(KC_F)),
+        KeymapKey(0, 4, 0, RSFT_T(KC_J)), KeymapKey(0, 5, 0, RCTL_T(KC_K)), KeymapKey(0, 6, 0, LALT_T(KC_L)), KeymapKey(0, 7, 0, RGUI_T(KC_SCLN)),
+        KeymapKey(0, 0, 1, KC_E),         KeymapKey(0, 1, 1, KC_R),         KeymapKey(0, 2, 1, KC_U),         KeymapKey(0, 3, 1, KC_I),
+    };
+    // clang-format on
+    std::vector<uint16_t>  typed;
+    uint8_t                held[KEYBOARD_REPORT_KEYS] = {};
+    bool                   saw_mods                  = false;
+};
+
+// A sequence of `length` keys, where a key is not repeated until three others were pressed
+static std::vector<size_t> roll_sequence(size_t length, size_t key_count) {
+    std::vector<size_t> sequence;
+    uint32_t            seed = 12345;
+    while (sequence.size() < length) {
+        seed         = seed * 1103515245 + 12345;
+        size_t index = (seed >> 16) % key_count;
+        size_t since = std::min<size_t>(sequence.size(), 3);
+        if (std::find(sequence.end() - since, sequence.end(), index) == sequence.end()) {
+            sequence.push_back(index);
+        }
+    }
+    return sequence;
+}
+
+TEST_F(RollStress, HomeRowModRoll) {
+    TestDriver driver;
+    capture(driver);
+
+    // 50 keys per second, each overlapping the next two
+    std::vector<size_t> sequence = roll_sequence(60, 8);
+    roll(sequence, 20, 50);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(typed, tap_keycodes(sequence));
+    EXPECT_FALSE(saw_mods);
+}
+
+TEST_F(RollStress, MixedRollAtTypingBurstRate) {
+    TestDriver driver;
+    capture(driver);
+
+    // 100 keys per second over mod-tap and regular keys, each overlapping the next three
+    std::vector<size_t> sequence = roll_sequence(80, keys.size());
+    roll(sequence, 10, 35);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(typed, tap_keycodes(sequence));
+    EXPECT_FALSE(saw_mods);
+}
+
+TEST_F(RollStress, LongRollWhileModTapIsUndecided) {
+    TestDriver driver;
+    capture(driver);
+
+    // Hold the first key across twenty events of regular keys, more than the default buffer holds
+    std::vector<size_t> sequence = {3, 8, 9, 10, 11, 8, 9, 10, 11, 8, 9};
+    unsigned            time     = 0;
+    keys[3].press();
+    for (size_t i = 1; i < sequence.size(); i++) {
+        keys[sequence[i]].press();
+        run_one_scan_loop();
+        keys[sequence[i]].release();
+        run_one_scan_loop();
+        time += 2;
+    }
+    ASSERT_LT(time, TAPPING_TERM);
+    keys[3].release();
+    run_one_scan_loop();
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(typed, tap_keycodes(sequence));
+    EXPECT_FALSE(saw_mods);
+}
@@ -22,6 +22,7 @@ extern "C" {
 #include "debug.h"
 #include "eeconfig.h"
 #include "keyboard.h"
+#include "keymap_common.h"
 
 void set_time(uint32_t t);
 void advance_time(uint32_t ms);
@@ -58,6 +59,12 @@ void TestFixture::TearDownTestCase() {}
 TestFixture::TestFixture() {
     m_this = this;
     timer_clear();
+#ifdef KEYMAP_ACTION_CACHE
+    keymap_action_cache_invalidate();
+#endif
+#ifdef LAYER_OPACITY_CACHE
+    layer_opacity_cache_invalidate();
+#endif
     test_logger.info() << "tapping term is " << +GET_TAPPING_TERM(KC_TRANSPARENT, &(keyrecord_t){}) << "ms" << std::endl;
 }
 
@@ -99,6 +106,12 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+#ifdef KEYMAP_ACTION_CACHE
+    keymap_action_cache_invalidate_key(key.layer, key.position.row, key.position.col);
+#endif
+#ifdef LAYER_OPACITY_CACHE
+    layer_opacity_cache_invalidate_key(key.position.row, key.position.col);
+#endif
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -51,6 +51,10 @@
 extern keymap_config_t keymap_config;
 #endif
 
+#ifdef LATENCY_TRACER_ENABLE
+#    include "latency_tracer.h"
+#endif
+
 /* ---------------------------------------------------------
  *       Global interface variables and declarations
  * ---------------------------------------------------------
@@ -128,6 +132,20 @@ static void dummy_usb_cb(USBDriver *usbp, usbep_t ep) {
     (void)ep;
 }
 
+#ifdef LATENCY_TRACER_ENABLE
+/*
+ * IN notification callback for the endpoints carrying keyboard reports, marking
+ * the end of their transfer for the latency tracer.
+ */
+static void report_in_cb(USBDriver *usbp, usbep_t ep) {
+    (void)usbp;
+    latency_tracer_transfer_completed_i(ep);
+}
+#    define REPORT_IN_CB report_in_cb
+#else
+#    define REPORT_IN_CB dummy_usb_cb
+#endif
+
 #ifndef KEYBOARD_SHARED_EP
 /* keyboard endpoint state structure */
 static USBInEndpointState kbd_ep_state;
@@ -135,7 +153,7 @@ static USBInEndpointState kbd_ep_state;
 static const USBEndpointConfig kbd_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    REPORT_IN_CB,           /* IN notification callback */
     NULL,                   /* OUT notification callback */
     KEYBOARD_EPSIZE,        /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -171,7 +189,7 @@ static USBInEndpointState shared_ep_state;
 static const USBEndpointConfig shared_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    REPORT_IN_CB,           /* IN notification callback */
     NULL,                   /* OUT notification callback */
     SHARED_EPSIZE,          /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -826,9 +844,14 @@ uint8_t keyboard_leds(void) {
     return keyboard_led_state;
 }
 
-void send_report(uint8_t endpoint, void *report, size_t size) {
+/* Keyboard and NKRO reports are traced, so that the latency tracer does not attribute
+ * a keyboard event to a report sent on another endpoint */
+static void send_report_traced(uint8_t endpoint, void *report, size_t size, bool traced) {
     osalSysLock();
     if (usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE) {
+#ifdef LATENCY_TRACER_ENABLE
+        if (traced) latency_tracer_transfer_dropped_i();
+#endif
         osalSysUnlock();
         return;
     }
@@ -839,22 +862,34 @@ void send_report(uint8_t endpoint, void *report, size_t size) {
          * no interrupts served, so USB not going through as well.
          * Note: for suspend, need USB_USE_WAIT == TRUE in halconf.h */
         if (osalThreadSuspendTimeoutS(&(&USB_DRIVER)->epc[endpoint]->in_state->thread, TIME_MS2I(10)) == MSG_TIMEOUT) {
+#ifdef LATENCY_TRACER_ENABLE
+            if (traced) latency_tracer_transfer_dropped_i();
+#endif
             osalSysUnlock();
             return;
         }
     }
+#ifdef LATENCY_TRACER_ENABLE
+    if (traced) latency_tracer_transfer_started_i(endpoint);
+#else
+    (void)traced;
+#endif
     usbStartTransmitI(&USB_DRIVER, endpoint, report, size);
     osalSysUnlock();
 }
 
+void send_report(uint8_t endpoint, void *report, size_t size) {
+    send_report_traced(endpoint, report, size, false);
+}
+
 /* prepare and start sending a report IN
  * not callable from ISR or locked state */
 void send_keyboard(report_keyboard_t *report) {
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (!keyboard_protocol) {
-        send_report(KEYBOARD_IN_EPNUM, &report->mods, 8);
+        send_report_traced(KEYBOARD_IN_EPNUM, &report->mods, 8, true);
     } else {
-        send_report(KEYBOARD_IN_EPNUM, report, KEYBOARD_REPORT_SIZE);
+        send_report_traced(KEYBOARD_IN_EPNUM, report, KEYBOARD_REPORT_SIZE, true);
     }
 
     keyboard_report_sent = *report;
@@ -862,7 +897,7 @@ void send_keyboard(report_keyboard_t *report) {
 
 void send_nkro(report_nkro_t *report) {
 #ifdef NKRO_ENABLE
-    send_report(SHARED_IN_EPNUM, report, sizeof(report_nkro_t));
+    send_report_traced(SHARED_IN_EPNUM, report, sizeof(report_nkro_t), true);
 #endif
 }
 
@@ -21,6 +21,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "host.h"
 #include "util.h"
 #include "debug.h"
+#include "action_util.h"
 
 #ifdef DIGITIZER_ENABLE
 #    include "digitizer.h"
@@ -35,6 +36,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "outputselect.h"
 #endif
 
+#ifdef LATENCY_TRACER_ENABLE
+#    include "latency_tracer.h"
+#endif
+
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
 extern keymap_config_t keymap_config;
@@ -73,6 +78,10 @@ led_t host_keyboard_led_state(void) {
 
 /* send report */
 void host_keyboard_send(report_keyboard_t *report) {
+#ifdef LATENCY_TRACER_ENABLE
+    latency_tracer_report_queued();
+#endif
+
 #ifdef BLUETOOTH_ENABLE
     if (where_to_send() == OUTPUT_BLUETOOTH) {
         bluetooth_send_keyboard(report);
@@ -97,6 +106,9 @@ void host_keyboard_send(report_keyboard_t *report) {
 
 void host_nkro_send(report_nkro_t *report) {
     if (!driver) return;
+#ifdef LATENCY_TRACER_ENABLE
+    latency_tracer_report_queued();
+#endif
     report->report_id = REPORT_ID_NKRO;
     (*driver->send_nkro)(report);
 
@@ -110,6 +122,9 @@ void host_nkro_send(report_nkro_t *report) {
 }
 
 void host_mouse_send(report_mouse_t *report) {
+    // A keyboard report held back by report coalescing must reach the host first
+    flush_keyboard_report();
+
 #ifdef BLUETOOTH_ENABLE
     if (where_to_send() == OUTPUT_BLUETOOTH) {
         bluetooth_send_mouse(report);
@@ -130,6 +145,8 @@ void host_mouse_send(report_mouse_t *report) {
 }
 
 void host_system_send(uint16_t usage) {
+    flush_keyboard_report();
+
     if (usage == last_system_usage) return;
     last_system_usage = usage;
 
@@ -143,6 +160,8 @@ void host_system_send(uint16_t usage) {
 }
 
 void host_consumer_send(uint16_t usage) {
+    flush_keyboard_report();
+
     if (usage == last_consumer_usage) return;
     last_consumer_usage = usage;
 
@@ -164,6 +183,8 @@ void host_consumer_send(uint16_t usage) {
 
 #ifdef JOYSTICK_ENABLE
 void host_joystick_send(joystick_t *joystick) {
+    flush_keyboard_report();
+
     if (!driver) return;
 
     report_joystick_t report = {
@@ -219,6 +240,8 @@ __attribute__((weak)) void send_joystick(report_joystick_t *report) {}
 
 #ifdef DIGITIZER_ENABLE
 void host_digitizer_send(digitizer_t *digitizer) {
+    flush_keyboard_report();
+
     report_digitizer_t report = {
 #    ifdef DIGITIZER_SHARED_EP
         .report_id = REPORT_ID_DIGITIZER,
@@ -238,6 +261,8 @@ __attribute__((weak)) void send_digitizer(report_digitizer_t *report) {}
 
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
 void host_programmable_button_send(uint32_t data) {
+    flush_keyboard_report();
+
     report_programmable_button_t report = {
         .report_id = REPORT_ID_PROGRAMMABLE_BUTTON,
         .usage     = data,
@@ -32,24 +32,43 @@ static int8_t cb_tail  = 0;
 static int8_t cb_count = 0;
 #endif
 
+// Keys held in the 6KRO report, mirrored as a bitmap so that lookups and no-op updates don't need to scan it
+static uint8_t keys_bitmap[32];
+static uint8_t keys_count = 0;
+// Set whenever the keys of the report change, cleared once it has been sent
+static bool keys_dirty = false;
+
+static inline bool keys_bitmap_get(uint8_t key) {
+    return keys_bitmap[key >> 3] & (1 << (key & 7));
+}
+
+static inline void keys_bitmap_set(uint8_t key) {
+    keys_bitmap[key >> 3] |= 1 << (key & 7);
+    keys_count++;
+}
+
+static inline void keys_bitmap_clear(uint8_t key) {
+    keys_bitmap[key >> 3] &= ~(1 << (key & 7));
+    keys_count--;
+}
+
 /** \brief has_anykey
  *
- * FIXME: Needs doc
+ * Returns the number of keys held in the 6KRO report, or the number of non-empty bytes of the NKRO report.
  */
 uint8_t has_anykey(void) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
-        p  = nkro_report->bits;
-        lp = sizeof(nkro_report->bits);
+        uint8_t  cnt = 0;
+        uint8_t* p   = nkro_report->bits;
+        uint8_t  lp  = sizeof(nkro_report->bits);
+        while (lp--) {
+            if (*p++) cnt++;
+        }
+        return cnt;
     }
 #endif
-    while (lp--) {
-        if (*p++) cnt++;
-    }
-    return cnt;
+    return keys_count;
 }
 
 /** \brief get_first_key
@@ -97,26 +116,21 @@ bool is_key_pressed(uint8_t key) {
         }
     }
 #endif
-    for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
-        if (keyboard_report->keys[i] == key) {
-            return true;
-        }
-    }
-    return false;
+    return keys_bitmap_get(key);
 }
 
 /** \brief add key byte
  *
- * FIXME: Needs doc
+ * Adds a key to a 6KRO report, returns false if it was already present or there was no room for it.
  */
-void add_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
+bool add_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
 #ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
     int8_t i     = cb_head;
     int8_t empty = -1;
     if (cb_count) {
         do {
             if (keyboard_report->keys[i] == code) {
-                return;
+                return false;
             }
             if (empty == -1 && keyboard_report->keys[i] == 0) {
                 empty = i;
@@ -153,6 +167,7 @@ void add_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
     keyboard_report->keys[cb_tail] = code;
     cb_tail                        = RO_INC(cb_tail);
     cb_count++;
+    return true;
 #else
     int8_t i     = 0;
     int8_t empty = -1;
@@ -167,16 +182,18 @@ void add_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
     if (i == KEYBOARD_REPORT_KEYS) {
         if (empty != -1) {
             keyboard_report->keys[empty] = code;
+            return true;
         }
     }
+    return false;
 #endif
 }
 
 /** \brief del key byte
  *
- * FIXME: Needs doc
+ * Removes a key from a 6KRO report, returns false if it was not present.
  */
-void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
+bool del_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
 #ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
     uint8_t i = cb_head;
     if (cb_count) {
@@ -197,80 +214,111 @@ void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
                         }
                     } while (cb_tail != cb_head);
                 }
-                break;
+                return true;
             }
             i = RO_INC(i);
         } while (i != cb_tail);
     }
+    return false;
 #else
+    bool removed = false;
     for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
         if (keyboard_report->keys[i] == code) {
             keyboard_report->keys[i] = 0;
+            removed                  = true;
         }
     }
+    return removed;
 #endif
 }
 
 #ifdef NKRO_ENABLE
 /** \brief add key bit
  *
- * FIXME: Needs doc
+ * Adds a key to an NKRO report, returns false if it was already present or cannot be represented.
  */
-void add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
+bool add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
+        uint8_t previous = nkro_report->bits[code >> 3];
         nkro_report->bits[code >> 3] |= 1 << (code & 7);
+        return nkro_report->bits[code >> 3] != previous;
     } else {
         dprintf("add_key_bit: can't add: %02X\n", code);
+        return false;
     }
 }
 
 /** \brief del key bit
  *
- * FIXME: Needs doc
+ * Removes a key from an NKRO report, returns false if it was not present.
  */
-void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
+bool del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
+        uint8_t previous = nkro_report->bits[code >> 3];
         nkro_report->bits[code >> 3] &= ~(1 << (code & 7));
+        return nkro_report->bits[code >> 3] != previous;
     } else {
         dprintf("del_key_bit: can't del: %02X\n", code);
+        return false;
     }
 }
 #endif
 
 /** \brief add key to report
  *
- * FIXME: Needs doc
+ * Adds a key to the report matching the current protocol, marking it dirty if it changed.
  */
 void add_key_to_report(uint8_t key) {
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
-        add_key_bit(nkro_report, key);
+        keys_dirty |= add_key_bit(nkro_report, key);
         return;
     }
 #endif
-    add_key_byte(keyboard_report, key);
+    if (key == KC_NO || keys_bitmap_get(key)) {
+        return;
+    }
+#ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
+    // A full ring buffer drops its oldest key to make room
+    uint8_t evicted = cb_count == KEYBOARD_REPORT_KEYS ? keyboard_report->keys[cb_head] : KC_NO;
+#endif
+    if (add_key_byte(keyboard_report, key)) {
+        keys_bitmap_set(key);
+#ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
+        if (evicted != KC_NO) {
+            keys_bitmap_clear(evicted);
+        }
+#endif
+        keys_dirty = true;
+    }
 }
 
 /** \brief del key from report
  *
- * FIXME: Needs doc
+ * Removes a key from the report matching the current protocol, marking it dirty if it changed.
  */
 void del_key_from_report(uint8_t key) {
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
-        del_key_bit(nkro_report, key);
+        keys_dirty |= del_key_bit(nkro_report, key);
         return;
     }
 #endif
+    if (!keys_bitmap_get(key)) {
+        return;
+    }
     del_key_byte(keyboard_report, key);
+    keys_bitmap_clear(key);
+    keys_dirty = true;
 }
 
 /** \brief clear key from report
  *
- * FIXME: Needs doc
+ * Removes all keys, but not the modifiers, from the report matching the current protocol.
  */
 void clear_keys_from_report(void) {
     // not clear mods
+    keys_dirty = true;
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
         memset(nkro_report->bits, 0, sizeof(nkro_report->bits));
@@ -278,6 +326,31 @@ void clear_keys_from_report(void) {
     }
 #endif
     memset(keyboard_report->keys, 0, sizeof(keyboard_report->keys));
+    memset(keys_bitmap, 0, sizeof(keys_bitmap));
+    keys_count = 0;
+#ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
+    cb_head  = 0;
+    cb_tail  = 0;
+    cb_count = 0;
+#endif
+}
+
+/** \brief Checks if the keys of the report changed since it was last sent
+ */
+bool is_key_report_dirty(void) {
+    return keys_dirty;
+}
+
+/** \brief Forces the report to be compared against the last one sent, on its next send
+ */
+void set_key_report_dirty(void) {
+    keys_dirty = true;
+}
+
+/** \brief Marks the keys of the report as sent
+ */
+void clear_key_report_dirty(void) {
+    keys_dirty = false;
 }
 
 #ifdef MOUSE_ENABLE